@@ -0,0 +1,57 @@
+/**
+ * @file asciiArtIcons.ino
+ * @brief Define icons as ASCII art, converted to column bytes by the compiler.
+ *
+ * SBK_MAX72xxArt() runs at compile time: only the column bytes are stored, in flash.
+ * The 16-column heart holds two 8-column frames played back by SBK_MAX72xxIcon.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ * @version 2.0.4
+ * @license MIT
+ */
+
+#include <Arduino.h>
+#include <SBK_MAX72xxHard.h>
+#include <SBK_MAX72xxBitmap.h>
+#include <SBK_MAX72xxWidgets.h>
+
+typedef SBK_MAX72xxHard Driver;
+
+static const SBK_MAX72xxBitmap<16> heart PROGMEM = SBK_MAX72xxArt(
+    ".XX..XX........."
+    "XXXXXXXX..X..X.."
+    "XXXXXXXX.XXXXXX."
+    "XXXXXXXX.XXXXXX."
+    ".XXXXXX...XXXX.."
+    "..XXXX.....XX..."
+    "...XX..........."
+    "................");
+
+static const SBK_MAX72xxBitmap<8> smiley PROGMEM = SBK_MAX72xxArt(
+    "..XXXX.."
+    ".X....X."
+    "X.X..X.X"
+    "X......X"
+    "X.X..X.X"
+    "X..XX..X"
+    ".X....X."
+    "..XXXX..");
+
+Driver matrix(10, 2); // cs pin, num devices
+SBK_MAX72xxCanvas<Driver> canvas(matrix, 16);
+SBK_MAX72xxScreen<Driver> screen(canvas);
+SBK_MAX72xxIcon<Driver> heartIcon(0, 0, 8, heart.cols, 2); // 2 frames of 8 columns
+SBK_MAX72xxIcon<Driver> smileyIcon(8, 0, 8, smiley.cols);
+
+void setup() {
+  matrix.begin();
+  screen.add(heartIcon);
+  screen.add(smileyIcon);
+}
+
+void loop() {
+  heartIcon.nextFrame(); // heartbeat
+  screen.update();       // only the heart's columns are sent
+  delay(400);
+}
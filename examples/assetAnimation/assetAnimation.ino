@@ -0,0 +1,38 @@
+/**
+ * @file assetAnimation.ino
+ * @brief Play a compressed animation produced by extras/assetCompiler.
+ *
+ * bounce.h was generated from bounce.gif with:
+ *   assetCompiler --delta bounce.gif bounce > bounce.h
+ * Frames are stored as run-length encoded differences (159 bytes instead of 512) and
+ * unpacked straight into column bytes, in the driver's orientation.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ * @version 2.0.4
+ * @license MIT
+ */
+
+#include <Arduino.h>
+#include <SBK_MAX72xxHard.h>
+#include <SBK_MAX72xxAsset.h>
+#include "bounce.h"
+
+SBK_MAX72xxHard matrix(10, 4); // cs pin, num devices (32 columns, as wide as the animation)
+uint8_t frame[bounce_width * bounce_bands];
+
+void setup() {
+  matrix.begin();
+}
+
+void loop() {
+  const uint8_t *src = bounce;
+  for (uint16_t f = 0; f < bounce_frames; f++) {
+    src = SBK_MAX72xxUnpack(src, frame, sizeof(frame), f > 0); // delta frames XOR into the previous one
+
+    for (uint8_t x = 0; x < bounce_width; x++)
+      matrix.setCol(x / 8, x % 8, frame[x]);
+    matrix.show(); // only the columns that changed are sent
+    delay(50);
+  }
+}
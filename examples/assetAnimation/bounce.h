@@ -0,0 +1,19 @@
+// Generated by assetCompiler from bounce.gif
+#pragma once
+// bounce.gif: 32 x 8, 16 frame(s), RLE + delta, decode frames with SBK_MAX72xxUnpack(..., xorInto = true after the first)
+// Band-major: band b of column x is byte b * bounce_width + x, frames back to back
+const uint16_t bounce_width = 32;
+const uint8_t bounce_bands = 1;
+const uint16_t bounce_frames = 16;
+const uint8_t bounce[] PROGMEM = {
+    0x01, 0xFF, 0x81, 0x80, 0x99, 0x99, 0x81, 0x00, 0xFF, 0x80, 0x00, 0x80, 0x18, 0x00, 0x00, 0x80,
+    0x18, 0x97, 0x00, 0x83, 0x00, 0x80, 0x18, 0x00, 0x00, 0x80, 0x18, 0x94, 0x00, 0x86, 0x00, 0x80,
+    0x18, 0x00, 0x00, 0x80, 0x18, 0x91, 0x00, 0x89, 0x00, 0x80, 0x18, 0x00, 0x00, 0x80, 0x18, 0x8E,
+    0x00, 0x8C, 0x00, 0x80, 0x18, 0x00, 0x00, 0x80, 0x18, 0x8B, 0x00, 0x8F, 0x00, 0x80, 0x18, 0x00,
+    0x00, 0x80, 0x18, 0x88, 0x00, 0x92, 0x00, 0x80, 0x18, 0x00, 0x00, 0x80, 0x18, 0x85, 0x00, 0x95,
+    0x00, 0x80, 0x18, 0x00, 0x00, 0x80, 0x18, 0x82, 0x00, 0x95, 0x00, 0x80, 0x18, 0x00, 0x00, 0x80,
+    0x18, 0x82, 0x00, 0x92, 0x00, 0x80, 0x18, 0x00, 0x00, 0x80, 0x18, 0x85, 0x00, 0x8F, 0x00, 0x80,
+    0x18, 0x00, 0x00, 0x80, 0x18, 0x88, 0x00, 0x8C, 0x00, 0x80, 0x18, 0x00, 0x00, 0x80, 0x18, 0x8B,
+    0x00, 0x89, 0x00, 0x80, 0x18, 0x00, 0x00, 0x80, 0x18, 0x8E, 0x00, 0x86, 0x00, 0x80, 0x18, 0x00,
+    0x00, 0x80, 0x18, 0x91, 0x00, 0x83, 0x00, 0x80, 0x18, 0x00, 0x00, 0x80, 0x18, 0x94, 0x00
+};
@@ -0,0 +1,42 @@
+/**
+ * @file bannerScroll.ino
+ * @brief Scroll a pre-rendered PROGMEM banner through a canvas viewport.
+ *
+ * The banner is never redrawn: each step only moves the viewport, and show()
+ * sends just the digit registers whose column byte changed.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ * @version 2.0.4
+ * @license MIT
+ */
+
+#include <Arduino.h>
+#include <SBK_MAX72xxHard.h>
+#include <SBK_MAX72xxCanvas.h>
+
+// "MAX72XX " in a 5x7 font, one column byte per column (row 0 = MSB)
+const uint8_t banner[] PROGMEM = {
+    0xFE, 0x40, 0x30, 0x40, 0xFE, 0x00, // M
+    0x7E, 0x90, 0x90, 0x90, 0x7E, 0x00, // A
+    0xC6, 0x28, 0x10, 0x28, 0xC6, 0x00, // X
+    0x80, 0x8E, 0x90, 0xA0, 0xC0, 0x00, // 7
+    0x42, 0x86, 0x8A, 0x92, 0x62, 0x00, // 2
+    0xC6, 0x28, 0x10, 0x28, 0xC6, 0x00, // X
+    0xC6, 0x28, 0x10, 0x28, 0xC6, 0x00, // X
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // gap
+};
+
+SBK_MAX72xxHard matrix(10, 4); // cs pin, num devices
+SBK_MAX72xxCanvas<SBK_MAX72xxHard> canvas(matrix, banner, sizeof(banner));
+
+void setup() {
+  matrix.begin();
+  canvas.setWrap(true); // endless loop
+}
+
+void loop() {
+  canvas.pan(1);
+  canvas.show();
+  delay(60);
+}
@@ -0,0 +1,63 @@
+/**
+ * @file bicolorMatrix.ino
+ * @brief Colored text and a bouncing dot on bi-color 8x8 modules (red + green chips).
+ *
+ * Four bi-color modules use eight MAX7219, red and green of each module on
+ * consecutive devices. Both planes of a digit go out in the same chain frame,
+ * so a pixel turning from red to green never flashes through black or yellow.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ * @version 2.0.4
+ * @license MIT
+ */
+
+#include <Arduino.h>
+#include <SBK_MAX72xxHard.h>
+#include <SBK_MAX72xxColor.h>
+#include <SBK_MAX72xxFont.h>
+
+typedef SBK_MAX72xxHard Driver;
+
+Driver chips(10, 8);                            // cs pin, num devices (4 modules × 2 planes)
+SBK_MAX72xxColorFrame<Driver, 2> frame(chips);  // 32 columns
+
+void drawText(const char *text, uint8_t color) {
+  const SBK_MAX72xxFont &font = SBK_MAX72xxFont5x7;
+  uint16_t x = 1;
+  for (; *text; text++) {
+    const uint8_t *glyph = font.glyph(*text);
+    for (uint8_t c = 0; c < font.width && glyph; c++, x++)
+      frame.drawCol(x, SBK_MAX72xxReadFlash(glyph + c), color);
+    x += font.spacing;
+  }
+}
+
+void setup() {
+  chips.begin();
+
+  const uint8_t colors[] = {SBK_MAX72xxRed, SBK_MAX72xxGreen, SBK_MAX72xxYellow};
+  for (uint8_t i = 0; i < 3; i++) {
+    frame.clear();
+    drawText("RGY", colors[i]);
+    frame.show();
+    delay(800);
+  }
+  frame.clear();
+}
+
+void loop() {
+  static int16_t x = 0, dx = 1;
+  static uint8_t y = 3;
+
+  frame.setPixel(x, y, SBK_MAX72xxBlack);
+  x += dx;
+  if (x <= 0 || x >= frame.width() - 1)
+    dx = -dx;
+
+  // Color follows the position: red on the left, yellow in the middle, green on the right
+  uint8_t color = x < 11 ? SBK_MAX72xxRed : x < 21 ? SBK_MAX72xxYellow : SBK_MAX72xxGreen;
+  frame.setPixel(x, y, color);
+  frame.show();
+  delay(40);
+}
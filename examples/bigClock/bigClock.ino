@@ -0,0 +1,39 @@
+/**
+ * @file bigClock.ino
+ * @brief Full-height HH:MM:SS clock on a 4-device strip, redrawn digit by digit.
+ *
+ * Each digit slot remembers the glyph it shows, so a tick rewrites the seconds
+ * columns that changed (3 at most) rather than all 32, and the colon blink
+ * costs two columns. The serial monitor shows how many columns each update wrote.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ * @version 2.0.4
+ * @license MIT
+ */
+
+#include <Arduino.h>
+#include <SBK_MAX72xxHard.h>
+#include <SBK_MAX72xxBigDigits.h>
+
+typedef SBK_MAX72xxHard Driver;
+
+Driver matrix(10, 4); // cs pin, num devices
+SBK_MAX72xxBigNumber<Driver> bigClock(matrix, SBK_MAX72xxDigits3x8, "88:88:88", 2); // 27 columns, centered
+
+void setup() {
+  Serial.begin(115200);
+  matrix.begin();
+}
+
+void loop() {
+  uint32_t s = millis() / 1000;
+  bigClock.setTime(s / 3600 % 24, s / 60 % 60, s % 60, false);
+  bigClock.setColon(millis() % 1000 < 500);
+
+  uint16_t written = bigClock.show(); // 0 when nothing changed
+  if (written) {
+    Serial.print(F("columns written: "));
+    Serial.println(written);
+  }
+}
@@ -0,0 +1,47 @@
+/**
+ * @file brightnessCalibration.ino
+ * @brief Even brightness across panels from different batches, with a smooth fade.
+ *
+ * Each panel gets a calibration offset (in logical levels) so the wall looks uniform,
+ * then the whole wall breathes through the 0–255 perceptual range. Dithering between
+ * adjacent intensity steps gives in-between shades; every update is a single chain
+ * frame, sent only when a panel's step changes.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ * @version 2.0.4
+ * @license MIT
+ */
+
+#include <Arduino.h>
+#include <SBK_MAX72xxHard.h>
+#include <SBK_MAX72xxBrightness.h>
+
+typedef SBK_MAX72xxHard Driver;
+
+Driver matrix(10, 4); // cs pin, num devices
+SBK_MAX72xxBrightness<Driver> brightness(matrix);
+
+// Measured by eye against panel 0: panel 1 is dimmer, panel 3 brighter
+const int8_t calibration[4] = {0, 12, 0, -18};
+
+void setup() {
+  matrix.begin();
+  for (uint8_t dev = 0; dev < matrix.devsNum(); dev++)
+    for (uint8_t col = 0; col < matrix.maxColumns(); col++)
+      matrix.setCol(dev, col, 0xFF);
+  matrix.show();
+
+  brightness.setOffsets(calibration);
+  brightness.setDither(true);
+}
+
+void loop() {
+  // Triangle wave over 4 s
+  uint16_t t = millis() % 4000;
+  uint8_t level = t < 2000 ? t * 255UL / 2000 : (4000 - t) * 255UL / 2000;
+
+  brightness.setLevel(level);
+  brightness.tick(); // one frame at most, only when a step changes
+  delayMicroseconds(500);
+}
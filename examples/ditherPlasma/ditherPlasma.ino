@@ -0,0 +1,45 @@
+/**
+ * @file ditherPlasma.ino
+ * @brief Render a moving grayscale plasma and show it dithered, as live video would be.
+ *
+ * Any 8-bit grayscale source works the same way (camera thumbnail, decoded image):
+ * SBK_MAX72xxDitherImage() writes it into the chain buffer, show() sends the changes.
+ * The same conversion is available offline in extras/ditherImage.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ * @version 2.0.4
+ * @license MIT
+ */
+
+#include <Arduino.h>
+#include <SBK_MAX72xxHard.h>
+#include <SBK_MAX72xxDither.h>
+
+const uint8_t DEVICES = 4;
+const uint8_t WIDTH = DEVICES * 8;
+
+SBK_MAX72xxHard matrix(10, DEVICES); // cs pin, num devices
+uint8_t gray[8][WIDTH];              // one grayscale frame, row-major
+
+// Triangle wave 0–255 with period 256
+uint8_t wave(uint16_t t) {
+  t &= 0xFF;
+  return t < 128 ? t * 2 : (255 - t) * 2;
+}
+
+void setup() {
+  matrix.begin();
+}
+
+void loop() {
+  uint16_t t = millis() / 16;
+
+  for (uint8_t y = 0; y < 8; y++)
+    for (uint8_t x = 0; x < WIDTH; x++)
+      gray[y][x] = (wave(x * 8 + t) + wave(y * 24 + x * 4 - t * 2)) / 2;
+
+  SBK_MAX72xxDitherImage(matrix, &gray[0][0], WIDTH, WIDTH);
+  matrix.show();
+  delay(33); // ~30 fps
+}
@@ -0,0 +1,88 @@
+/**
+ * @file effectsBenchmark.ino
+ * @brief Time a Game of Life step done per pixel with getLed()/setLed() against
+ *        the bit-parallel SBK_MAX72xxEffects::lifeStep(), then run the effects.
+ *
+ * Both versions compute the same 32x8 generation (4 devices, wrapped columns).
+ * Only the computation is timed: show() is not called inside the loops.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ * @version 2.0.4
+ * @license MIT
+ */
+
+#include <Arduino.h>
+#include <SBK_MAX72xxHard.h>
+#include <SBK_MAX72xxEffects.h>
+
+const uint8_t DEVICES = 4;
+const uint8_t WIDTH = DEVICES * 8;
+const uint16_t STEPS = 100;
+
+SBK_MAX72xxHard matrix(10, DEVICES); // cs pin, num devices
+SBK_MAX72xxEffects<SBK_MAX72xxHard> fx(matrix);
+
+bool cellAt(int x, uint8_t row) {
+  x = (x + WIDTH) % WIDTH;
+  return matrix.getLed(x / 8, row, x % 8);
+}
+
+void naiveLifeStep() {
+  static bool next[WIDTH][8];
+  for (uint8_t x = 0; x < WIDTH; x++)
+    for (uint8_t r = 0; r < 8; r++) {
+      uint8_t n = 0;
+      for (int dx = -1; dx <= 1; dx++)
+        for (int dr = -1; dr <= 1; dr++)
+          if ((dx || dr) && r + dr >= 0 && r + dr < 8)
+            n += cellAt(x + dx, r + dr);
+      next[x][r] = (n == 3) || (n == 2 && cellAt(x, r));
+    }
+  for (uint8_t x = 0; x < WIDTH; x++)
+    for (uint8_t r = 0; r < 8; r++)
+      matrix.setLed(x / 8, r, x % 8, next[x][r]);
+}
+
+void report(const char *name, uint32_t us) {
+  Serial.print(name);
+  Serial.print(": ");
+  Serial.print((float)us / STEPS, 1);
+  Serial.println(" us/step");
+}
+
+void setup() {
+  Serial.begin(115200);
+  matrix.begin();
+
+  fx.sparkle(1); // random start, about half the cells alive
+  fx.flush();
+
+  uint32_t t0 = micros();
+  for (uint16_t i = 0; i < STEPS; i++)
+    naiveLifeStep();
+  report("per-pixel Life", micros() - t0);
+
+  fx.capture(); // continue from the same generation
+  t0 = micros();
+  for (uint16_t i = 0; i < STEPS; i++)
+    fx.lifeStep();
+  report("SWAR Life     ", micros() - t0);
+
+  fx.show();
+}
+
+void loop() {
+  // Cycle through the effects, about 4 seconds each
+  static const uint8_t frames = 60;
+  uint8_t effect = (millis() / 4000) % 4;
+
+  switch (effect) {
+    case 0: fx.lifeStep(); break;
+    case 1: fx.rain(); break;
+    case 2: fx.fire(); break;
+    default: fx.dissolve(); break;
+  }
+  fx.show();
+  delay(1000 / frames);
+}
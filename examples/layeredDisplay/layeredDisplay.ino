@@ -0,0 +1,58 @@
+/**
+ * @file layeredDisplay.ino
+ * @brief Scrolling ticker, status icon and blinking cursor composited on one chain.
+ *
+ * Each element lives on its own SBK_MAX72xxCompositor layer. Blinking the cursor
+ * only recomposites the column it covers, and show() only sends the digit
+ * registers whose bytes changed.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ * @version 2.0.4
+ * @license MIT
+ */
+
+#include <Arduino.h>
+#include <SBK_MAX72xxHard.h>
+#include <SBK_MAX72xxCompositor.h>
+
+SBK_MAX72xxHard matrix(10, 4); // cs pin, num devices
+SBK_MAX72xxCompositor<SBK_MAX72xxHard> screen(matrix);
+
+uint8_t ticker, icon, cursor;
+
+void setup() {
+  matrix.begin();
+
+  ticker = screen.addLayer();                        // bottom: scrolling pattern
+  icon = screen.addLayer(SBK_MAX72xxBlend::Opaque);  // status icon hides the ticker behind it
+  cursor = screen.addLayer(SBK_MAX72xxBlend::Xor);   // cursor inverts whatever is below
+
+  // Icon: a small box on the last 4 columns, opaque over rows 1-6 there and transparent elsewhere
+  const uint8_t box[4] = {0x3C, 0x24, 0x24, 0x3C};
+  for (uint16_t x = 0; x < screen.width(); x++)
+    screen.setMaskCol(icon, x, x < screen.width() - 4 ? 0x00 : 0x7E);
+  for (uint8_t i = 0; i < 4; i++)
+    screen.setCol(icon, screen.width() - 4 + i, box[i]);
+
+  screen.setCol(cursor, 3, 0xFF);
+  screen.show();
+}
+
+void loop() {
+  static uint8_t phase = 0;
+  static uint32_t lastBlink = 0;
+
+  // Ticker: diagonal stripes moving one column per step
+  for (uint16_t x = 0; x < screen.width(); x++)
+    screen.setCol(ticker, x, 0x80 >> ((x + phase) % 8));
+  phase++;
+
+  if (millis() - lastBlink >= 500) {
+    lastBlink = millis();
+    screen.setVisible(cursor, !screen.visible(cursor));
+  }
+
+  screen.show();
+  delay(80);
+}
@@ -0,0 +1,74 @@
+/**
+ * @file pixelBenchmark.ino
+ * @brief Compare the per-pixel cost of setLed() with the unchecked fast API.
+ *
+ * Fills and clears the buffer of a 4-device chain with setLed(), setLedFast(),
+ * togglePixel() and writePixelSpan(), then prints the average time per pixel.
+ * Only the buffer is timed: show() is not called inside the loops.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ * @version 2.0.4
+ * @license MIT
+ */
+
+#include <Arduino.h>
+#include <SBK_MAX72xxHard.h>
+
+const uint8_t DEVICES = 4;
+const uint16_t PASSES = 50;
+const uint32_t PIXELS = (uint32_t)PASSES * DEVICES * 64 * 2; // set + clear
+
+SBK_MAX72xxHard matrix(10, DEVICES); // cs pin, num devices
+
+void report(const char *name, uint32_t us) {
+  Serial.print(name);
+  Serial.print(": ");
+  Serial.print(us * 1000.0 / PIXELS, 1);
+  Serial.println(" ns/pixel");
+}
+
+void setup() {
+  Serial.begin(115200);
+  matrix.begin();
+
+  uint32_t t0 = micros();
+  for (uint16_t p = 0; p < PASSES; p++)
+    for (uint8_t s = 0; s < 2; s++)
+      for (uint8_t d = 0; d < DEVICES; d++)
+        for (uint8_t r = 0; r < 8; r++)
+          for (uint8_t c = 0; c < 8; c++)
+            matrix.setLed(d, r, c, s == 0);
+  report("setLed        ", micros() - t0);
+
+  t0 = micros();
+  for (uint16_t p = 0; p < PASSES; p++)
+    for (uint8_t s = 0; s < 2; s++)
+      for (uint8_t d = 0; d < DEVICES; d++)
+        for (uint8_t r = 0; r < 8; r++)
+          for (uint8_t c = 0; c < 8; c++)
+            matrix.setLedFast(d, r, c, s == 0);
+  report("setLedFast    ", micros() - t0);
+
+  t0 = micros();
+  for (uint16_t p = 0; p < PASSES; p++)
+    for (uint8_t s = 0; s < 2; s++)
+      for (uint8_t d = 0; d < DEVICES; d++)
+        for (uint8_t r = 0; r < 8; r++)
+          for (uint8_t c = 0; c < 8; c++)
+            matrix.togglePixel(d, r, c);
+  report("togglePixel   ", micros() - t0);
+
+  t0 = micros();
+  for (uint16_t p = 0; p < PASSES; p++)
+    for (uint8_t s = 0; s < 2; s++)
+      for (uint8_t d = 0; d < DEVICES; d++)
+        for (uint8_t r = 0; r < 8; r++)
+          matrix.writePixelSpan(d, r, 0, 8, s == 0);
+  report("writePixelSpan", micros() - t0);
+
+  matrix.show();
+}
+
+void loop() {
+}
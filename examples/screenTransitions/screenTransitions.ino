@@ -0,0 +1,52 @@
+/**
+ * @file screenTransitions.ino
+ * @brief Cycle between two screens with every SBK_MAX72xxTransition style.
+ *
+ * Each step only rewrites the columns that can change, so transitions run
+ * at the chain's refresh rate; the delay below only sets their speed.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ * @version 2.0.4
+ * @license MIT
+ */
+
+#include <Arduino.h>
+#include <SBK_MAX72xxHard.h>
+#include <SBK_MAX72xxTransition.h>
+
+typedef SBK_MAX72xxTransitionType Type;
+
+const uint8_t DEVICES = 4;
+const uint8_t WIDTH = DEVICES * 8;
+
+SBK_MAX72xxHard matrix(10, DEVICES); // cs pin, num devices
+SBK_MAX72xxTransition<SBK_MAX72xxHard> transition(matrix);
+
+uint8_t screenA[WIDTH]; // one column byte per chain column (row 0 = MSB)
+uint8_t screenB[WIDTH];
+
+const Type types[] = {Type::WipeRight, Type::WipeLeft, Type::SlideLeft, Type::SlideRight,
+                      Type::SlideUp, Type::SlideDown, Type::Dissolve};
+
+void setup() {
+  matrix.begin();
+
+  for (uint8_t x = 0; x < WIDTH; x++) {
+    screenA[x] = (x % 8 < 4) ? 0xF0 : 0x0F; // checkerboard
+    screenB[x] = (x % 4 == 0) ? 0xFF : 0x81; // frames
+  }
+}
+
+void loop() {
+  static uint8_t n = 0;
+  const uint8_t *from = (n & 1) ? screenB : screenA;
+  const uint8_t *to = (n & 1) ? screenA : screenB;
+
+  transition.start(from, to, types[n % 7], 32);
+  while (transition.step())
+    delay(20);
+
+  n++;
+  delay(1000);
+}
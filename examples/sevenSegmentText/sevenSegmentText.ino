@@ -0,0 +1,46 @@
+/**
+ * @file sevenSegmentText.ino
+ * @brief Print numbers and scroll text on an 8-digit 7-segment module.
+ *
+ * Characters come from a flash segment table and '.' folds into the previous
+ * digit's decimal point. Only the digits whose character changed are sent, so a
+ * scroll step writes at most the 8 digit registers, and fewer when letters repeat.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ * @version 2.0.4
+ * @license MIT
+ */
+
+#include <Arduino.h>
+#include <SBK_MAX72xxHard.h>
+#include <SBK_MAX72xxSegment.h>
+
+typedef SBK_MAX72xxHard Driver;
+
+Driver module(10, 1); // cs pin, num devices
+SBK_MAX72xxSegmentDisplay<Driver> display(module);
+
+void setup() {
+  module.begin();
+
+  display.print("SBK 2.0.4", SBK_MAX72xxAlign::Center);
+  display.show();
+  delay(1500);
+
+  // Digits, '-' and blanks only: Auto switches the chip to Code-B decode
+  display.setDecodeMode(SBK_MAX72xxDecodeMode::Auto);
+  for (int32_t n = -20; n <= 20; n++) {
+    display.printNumber(n);
+    display.show();
+    delay(100);
+  }
+
+  display.setScrollText("HELLO from the MAX7219...");
+}
+
+void loop() {
+  display.scroll();
+  display.show();
+  delay(250);
+}
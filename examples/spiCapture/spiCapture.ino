@@ -0,0 +1,42 @@
+/**
+ * @file spiCapture.ino
+ * @brief Record the SPI traffic of a SBK_MAX72xx driver and dump it over Serial.
+ *
+ * Send 'f' for a text log of the captured frames, 'r' for the replayed register
+ * state of every device, or 'v' for a VCD waveform (paste into a .vcd file and
+ * open it with GTKWave).
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ * @version 2.0.4
+ * @license MIT
+ */
+
+#include <Arduino.h>
+#include <SBK_MAX72xxHard.h>
+
+SBK_MAX72xxHard matrix(10, 2);  // cs pin, num devices
+SBK_MAX72xxCapture capture(32); // keep the last 32 frames
+
+void setup() {
+  Serial.begin(115200);
+
+  matrix.setCapture(&capture);
+  matrix.begin();
+}
+
+void loop() {
+  // Walk one lit column across both devices
+  static uint8_t step = 0;
+  matrix.clear();
+  matrix.setCol(step / 8, step % 8, 0xFF);
+  matrix.show();
+  step = (step + 1) % 16;
+  delay(100);
+
+  switch (Serial.read()) {
+    case 'f': capture.printFrames(Serial); break;
+    case 'r': capture.printRegisters(Serial); break;
+    case 'v': capture.writeVCD(Serial, 1000000); break;
+  }
+}
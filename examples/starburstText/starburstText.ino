@@ -0,0 +1,44 @@
+/**
+ * @file starburstText.ino
+ * @brief Readable text on 14-segment displays, two digit columns per character.
+ *
+ * Two chained MAX7219 drive 8 starburst characters (16 digit columns). Only the
+ * characters whose segments changed are written; the counter below touches one or
+ * two characters per update.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ * @version 2.0.4
+ * @license MIT
+ */
+
+#include <Arduino.h>
+#include <SBK_MAX72xxHard.h>
+#include <SBK_MAX72xxStarburst.h>
+
+typedef SBK_MAX72xxHard Driver;
+
+Driver chips(10, 2); // cs pin, num devices
+SBK_MAX72xxStarburstDisplay<Driver> display(chips, SBK_MAX72xxStarburst14);
+
+// Logical segment -> column pair bit, as soldered on the board (here: identity)
+const uint8_t wiring[16] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+
+void setup() {
+  chips.begin();
+  display.setWiring(wiring);
+
+  display.print("HELLO", SBK_MAX72xxAlign::Center);
+  display.show();
+  delay(1500);
+}
+
+void loop() {
+  static uint16_t count = 0;
+  char text[10];
+  snprintf(text, sizeof(text), "RUN %4u", count++);
+
+  display.print(text);
+  display.show(); // rewrites only the digits that changed
+  delay(200);
+}
@@ -0,0 +1,47 @@
+/**
+ * @file usartSecondChain.ino
+ * @brief Drive two MAX72xx chains at hardware speed on an ATmega328P.
+ *
+ * Chain 1 uses the SPI peripheral (SBK_MAX72xxHard): DIN = D11, CLK = D13, CS = D10.
+ * Chain 2 uses USART0 in Master SPI mode (SBK_MAX72xxUsart): DIN = D1 (TX), CLK = D4 (XCK0), CS = D7.
+ * Chain 2 is refreshed in the background from the USART interrupts.
+ *
+ * @note USART0 is the Serial port: don't use Serial in this sketch.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ * @version 2.0.4
+ * @license MIT
+ */
+
+#include <Arduino.h>
+#include <SBK_MAX72xxHard.h>
+#include <SBK_MAX72xxUsart.h>
+
+SBK_MAX72xxHard chain1(10, 4);     // cs pin, num devices
+SBK_MAX72xxUsart chain2(7, 4, 0);  // cs pin, num devices, USART number
+
+SBK_MAX72XX_USART_ISR(USART, chain2) // USART_UDRE_vect / USART_TX_vect on ATmega328P
+
+void setup() {
+  chain1.begin();
+
+  chain2.setSPIClock(8000000); // fosc/2 on a 16 MHz board
+  chain2.begin();
+}
+
+void loop() {
+  static uint8_t step = 0;
+
+  // Scroll one lit column along both chains
+  chain1.clear();
+  chain1.setCol(step / 8, step % 8, 0xFF);
+  chain1.show();
+
+  chain2.clear();
+  chain2.setCol(step / 8, step % 8, 0xFF);
+  chain2.showAsync(); // returns at once; the ISR sends the frames
+
+  step = (step + 1) % 32;
+  delay(50);
+}
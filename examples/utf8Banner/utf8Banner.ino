@@ -0,0 +1,42 @@
+/**
+ * @file utf8Banner.ino
+ * @brief Scroll a French (UTF-8) message drawn once on a wide canvas.
+ *
+ * SBK_MAX72xxFont5x7Latin finds accented letters by binary search in a sparse flash
+ * table and falls back to the ASCII font; a small glyph cache skips repeated lookups.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ * @version 2.0.4
+ * @license MIT
+ */
+
+#include <Arduino.h>
+#include <SBK_MAX72xxHard.h>
+#include <SBK_MAX72xxWidgets.h>
+
+typedef SBK_MAX72xxHard Driver;
+
+const uint16_t TEXT_WIDTH = 204; // 32 characters × 6 columns, plus a gap before it repeats
+
+Driver matrix(10, 4); // cs pin, num devices
+SBK_MAX72xxCanvas<Driver> canvas(matrix, TEXT_WIDTH);
+SBK_MAX72xxScreen<Driver, 1> screen(canvas);
+SBK_MAX72xxLabel<Driver, 48> message(0, 0, TEXT_WIDTH, "Bienvenue à Québec! Fermé à 17 h", SBK_MAX72xxAlign::Left);
+SBK_MAX72xxGlyphCache glyphCache;
+
+void setup() {
+  matrix.begin();
+  message.setFont(SBK_MAX72xxFont5x7Latin);
+  message.setGlyphCache(&glyphCache);
+  screen.add(message);
+  screen.update(); // render the text once
+
+  canvas.setWrap(true);
+}
+
+void loop() {
+  canvas.pan(1); // scrolling never redraws the text
+  canvas.show();
+  delay(50);
+}
@@ -0,0 +1,43 @@
+/**
+ * @file widgetDashboard.ino
+ * @brief Clock, counter and bar graph widgets sharing one 8-device chain.
+ *
+ * Each widget only redraws when its value changes, and only the digit registers
+ * whose column byte changed are sent: the colon blink costs two columns per tick.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ * @version 2.0.4
+ * @license MIT
+ */
+
+#include <Arduino.h>
+#include <SBK_MAX72xxHard.h>
+#include <SBK_MAX72xxWidgets.h>
+
+typedef SBK_MAX72xxHard Driver;
+
+Driver matrix(10, 8); // cs pin, num devices
+SBK_MAX72xxCanvas<Driver> canvas(matrix, 64);
+SBK_MAX72xxScreen<Driver> screen(canvas);
+
+SBK_MAX72xxClock<Driver> clockWidget(0, 0, 30); // HH:MM
+SBK_MAX72xxCounter<Driver> counter(30, 0, 18);  // right-aligned
+SBK_MAX72xxBar<Driver> bar(48, 0, 16, 1023);    // analog level
+
+void setup() {
+  matrix.begin();
+  screen.add(clockWidget);
+  screen.add(counter);
+  screen.add(bar);
+}
+
+void loop() {
+  uint32_t s = millis() / 1000;
+  clockWidget.setTime(s / 3600 % 24, s / 60 % 60);
+  clockWidget.setColon(millis() % 1000 < 500);
+  counter.setValue(s % 1000);
+  bar.setValue(analogRead(A0));
+
+  screen.update(); // no-op when nothing changed
+}
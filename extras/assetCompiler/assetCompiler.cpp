@@ -0,0 +1,967 @@
+/**
+ * @file assetCompiler.cpp
+ * @brief Host tool: convert PNG images, GIF animations and BDF fonts into PROGMEM headers.
+ *
+ * Output is already in the driver's column-byte order and orientation (row 0 = MSB), so
+ * sketches copy bytes and never convert formats at run time:
+ *  - PNG: band-major column bytes (band b of column x is byte b × width + x), ready for the
+ *    strip constructor of SBK_MAX72xxCanvas or SBK_MAX72xxIcon.
+ *  - GIF: every frame composited and converted, frames back to back.
+ *  - BDF: a SBK_MAX72xxFont (glyphs up to 8 rows tall), optionally limited to a range or to
+ *    the characters of a UTF-8 string. Subsets and codepoints above 0xFF give a sparse font.
+ * Images are thresholded or Bayer-dithered with SBK_MAX72xxDither.h. With --rle (and
+ * --delta for animations) frames are run-length encoded for SBK_MAX72xxUnpack().
+ * The flash used by each asset is reported on stderr.
+ *
+ * Build: g++ -std=c++11 -O2 -I../../src assetCompiler.cpp -o assetCompiler
+ * Usage: assetCompiler [options] input.(png|gif|bdf) name > asset.h
+ *   --threshold N   Lit when luminance >= N (default 128)
+ *   --dither        Bayer 8x8 ordered dither instead of a threshold
+ *   --invert        Swap lit and unlit pixels
+ *   --rle           Run-length encode each frame
+ *   --delta         Encode GIF frames as the XOR of the previous one (implies --rle)
+ *   --range A-B     BDF: keep glyphs A to B only (decimal or 0x hex, default 0x20-0x7E)
+ *   --chars TEXT    BDF: keep the characters of the UTF-8 TEXT only (sparse font)
+ *   --fallback F    BDF: font searched for missing characters, e.g. SBK_MAX72xxFont5x7
+ *   --spacing N     BDF: blank columns after each glyph (default 1)
+ *
+ * PNG support: non-interlaced, every color type, bit depths 1–16. GIF: GIF87a/89a with
+ * transparency and disposal methods.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ * @version 2.0.4
+ * @license MIT
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "SBK_MAX72xxDither.h"
+#include "SBK_MAX72xxFont.h"
+
+typedef std::vector<uint8_t> Bytes;
+
+struct Options
+{
+    int threshold = 128;
+    bool dither = false;
+    bool invert = false;
+    bool rle = false;
+    bool delta = false;
+    int first = 0x20;
+    int last = 0x7E;
+    int spacing = 1;
+    std::vector<int> chars; // BDF subset given as UTF-8 text
+    std::string fallback;
+};
+
+/// Grayscale picture (0 = off, 255 = on), row-major.
+struct Gray
+{
+    int width = 0;
+    int height = 0;
+    Bytes pixels;
+};
+
+static void fail(const char *what, const char *detail = "")
+{
+    fprintf(stderr, "assetCompiler: %s%s\n", what, detail);
+    exit(1);
+}
+
+static Bytes readFile(const char *path)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f)
+        fail("cannot open ", path);
+
+    Bytes data;
+    uint8_t chunk[4096];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0)
+        data.insert(data.end(), chunk, chunk + n);
+    fclose(f);
+    return data;
+}
+
+static uint8_t luminance(int r, int g, int b, int a)
+{
+    // Alpha blends over an unlit (black) background
+    return static_cast<uint8_t>((r * 299 + g * 587 + b * 114) / 1000 * a / 255);
+}
+
+// ---------------------------------------------------------------------------
+// Inflate (RFC 1951), enough for PNG's zlib streams
+// ---------------------------------------------------------------------------
+
+struct BitReader
+{
+    const uint8_t *data;
+    size_t size;
+    size_t pos = 0;
+    uint32_t bitBuf = 0;
+    int bitCount = 0;
+
+    BitReader(const uint8_t *d, size_t n) : data(d), size(n) {}
+
+    int bits(int need)
+    {
+        // LSB-first, as in deflate and GIF's LZW
+        while (bitCount < need)
+        {
+            if (pos >= size)
+                fail("truncated compressed data");
+            bitBuf |= static_cast<uint32_t>(data[pos++]) << bitCount;
+            bitCount += 8;
+        }
+        int value = bitBuf & ((1u << need) - 1);
+        bitBuf >>= need;
+        bitCount -= need;
+        return value;
+    }
+
+    void alignToByte()
+    {
+        bitBuf = 0;
+        bitCount = 0;
+    }
+};
+
+struct Huffman
+{
+    uint16_t counts[16];
+    uint16_t symbols[288];
+
+    void build(const uint8_t *lengths, int n)
+    {
+        uint16_t offsets[16];
+        memset(counts, 0, sizeof(counts));
+        for (int i = 0; i < n; i++)
+            counts[lengths[i]]++;
+        counts[0] = 0;
+
+        offsets[1] = 0;
+        for (int len = 1; len < 15; len++)
+            offsets[len + 1] = offsets[len] + counts[len];
+        for (int i = 0; i < n; i++)
+        {
+            if (lengths[i])
+                symbols[offsets[lengths[i]]++] = i;
+        }
+    }
+
+    int decode(BitReader &in) const
+    {
+        // Canonical code: walk the lengths, comparing against each length's first code
+        int code = 0, first = 0, index = 0;
+        for (int len = 1; len < 16; len++)
+        {
+            code |= in.bits(1);
+            int count = counts[len];
+            if (code - first < count)
+                return symbols[index + code - first];
+            index += count;
+            first = (first + count) << 1;
+            code <<= 1;
+        }
+        fail("invalid Huffman code");
+        return 0;
+    }
+};
+
+static Bytes inflate(const uint8_t *data, size_t size)
+{
+    static const uint16_t lengthBase[29] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27,
+                                            31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+    static const uint8_t lengthExtra[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2,
+                                            2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+    static const uint16_t distBase[30] = {1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129,
+                                          193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097,
+                                          6145, 8193, 12289, 16385, 24577};
+    static const uint8_t distExtra[30] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6,
+                                          6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+    static const uint8_t lengthOrder[19] = {16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+
+    if (size < 2 || (data[0] & 0x0F) != 8)
+        fail("PNG data is not a zlib deflate stream");
+
+    BitReader in(data + 2, size - 2); // Skip the zlib header
+    Bytes out;
+    bool last = false;
+
+    while (!last)
+    {
+        last = in.bits(1);
+        int type = in.bits(2);
+
+        if (type == 0)
+        {
+            // Stored block
+            in.alignToByte();
+            if (in.pos + 4 > in.size)
+                fail("truncated stored block");
+            size_t len = in.data[in.pos] | (in.data[in.pos + 1] << 8);
+            in.pos += 4;
+            if (in.pos + len > in.size)
+                fail("truncated stored block");
+            out.insert(out.end(), in.data + in.pos, in.data + in.pos + len);
+            in.pos += len;
+            continue;
+        }
+
+        Huffman lit, dist;
+        uint8_t lengths[320];
+        if (type == 1)
+        {
+            // Fixed codes
+            for (int i = 0; i < 288; i++)
+                lengths[i] = (i < 144) ? 8 : (i < 256) ? 9 : (i < 280) ? 7 : 8;
+            lit.build(lengths, 288);
+            for (int i = 0; i < 30; i++)
+                lengths[i] = 5;
+            dist.build(lengths, 30);
+        }
+        else if (type == 2)
+        {
+            // Dynamic codes, themselves Huffman-coded
+            int nLit = in.bits(5) + 257;
+            int nDist = in.bits(5) + 1;
+            int nLen = in.bits(4) + 4;
+
+            uint8_t lenLengths[19] = {0};
+            for (int i = 0; i < nLen; i++)
+                lenLengths[lengthOrder[i]] = in.bits(3);
+            Huffman lenCode;
+            lenCode.build(lenLengths, 19);
+
+            int i = 0;
+            while (i < nLit + nDist)
+            {
+                int sym = lenCode.decode(in);
+                int repeat = 0;
+                uint8_t value = 0;
+                if (sym < 16)
+                {
+                    lengths[i++] = sym;
+                    continue;
+                }
+                if (sym == 16)
+                {
+                    if (i == 0)
+                        fail("invalid code lengths");
+                    value = lengths[i - 1];
+                    repeat = 3 + in.bits(2);
+                }
+                else if (sym == 17)
+                    repeat = 3 + in.bits(3);
+                else
+                    repeat = 11 + in.bits(7);
+
+                if (i + repeat > nLit + nDist)
+                    fail("invalid code lengths");
+                while (repeat--)
+                    lengths[i++] = value;
+            }
+            lit.build(lengths, nLit);
+            dist.build(lengths + nLit, nDist);
+        }
+        else
+        {
+            fail("invalid deflate block type");
+        }
+
+        for (;;)
+        {
+            int sym = lit.decode(in);
+            if (sym < 256)
+            {
+                out.push_back(sym);
+                continue;
+            }
+            if (sym == 256)
+                break;
+
+            sym -= 257;
+            if (sym >= 29)
+                fail("invalid length code");
+            size_t len = lengthBase[sym] + in.bits(lengthExtra[sym]);
+            int d = dist.decode(in);
+            if (d >= 30)
+                fail("invalid distance code");
+            size_t back = distBase[d] + in.bits(distExtra[d]);
+            if (back > out.size())
+                fail("distance too far back");
+            size_t from = out.size() - back;
+            for (size_t k = 0; k < len; k++)
+                out.push_back(out[from + k]);
+        }
+    }
+    return out;
+}
+
+// ---------------------------------------------------------------------------
+// PNG
+// ---------------------------------------------------------------------------
+
+static uint32_t be32(const uint8_t *p)
+{
+    return (static_cast<uint32_t>(p[0]) << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+}
+
+static int paeth(int a, int b, int c)
+{
+    int p = a + b - c;
+    int pa = abs(p - a), pb = abs(p - b), pc = abs(p - c);
+    return (pa <= pb && pa <= pc) ? a : (pb <= pc) ? b : c;
+}
+
+static Gray loadPng(const Bytes &file)
+{
+    static const uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    if (file.size() < 8 || memcmp(file.data(), signature, 8) != 0)
+        fail("not a PNG file");
+
+    int width = 0, height = 0, depth = 0, colorType = 0;
+    Bytes idat, palette, paletteAlpha;
+
+    size_t pos = 8;
+    while (pos + 12 <= file.size())
+    {
+        uint32_t len = be32(&file[pos]);
+        const char *type = reinterpret_cast<const char *>(&file[pos + 4]);
+        const uint8_t *chunk = &file[pos + 8];
+        if (pos + 12 + len > file.size())
+            fail("truncated PNG chunk");
+
+        if (!memcmp(type, "IHDR", 4))
+        {
+            width = be32(chunk);
+            height = be32(chunk + 4);
+            depth = chunk[8];
+            colorType = chunk[9];
+            if (chunk[12])
+                fail("interlaced PNG is not supported, save it non-interlaced");
+        }
+        else if (!memcmp(type, "PLTE", 4))
+            palette.assign(chunk, chunk + len);
+        else if (!memcmp(type, "tRNS", 4))
+            paletteAlpha.assign(chunk, chunk + len);
+        else if (!memcmp(type, "IDAT", 4))
+            idat.insert(idat.end(), chunk, chunk + len);
+        else if (!memcmp(type, "IEND", 4))
+            break;
+        pos += 12 + len;
+    }
+
+    static const int channelsByType[7] = {1, 0, 3, 1, 2, 0, 4};
+    int channels = (colorType <= 6) ? channelsByType[colorType] : 0;
+    if (!width || !height || !channels)
+        fail("unsupported PNG header");
+
+    const size_t bitsPerPixel = channels * depth;
+    const size_t stride = (width * bitsPerPixel + 7) / 8;
+    const size_t step = (bitsPerPixel + 7) / 8; // Filter distance in bytes
+
+    Bytes raw = inflate(idat.data(), idat.size());
+    if (raw.size() < (stride + 1) * height)
+        fail("truncated PNG image data");
+
+    // Undo the per-row filters in place
+    Bytes prev(stride, 0);
+    for (int y = 0; y < height; y++)
+    {
+        uint8_t filter = raw[y * (stride + 1)];
+        uint8_t *row = &raw[y * (stride + 1) + 1];
+        for (size_t i = 0; i < stride; i++)
+        {
+            int a = (i >= step) ? row[i - step] : 0;
+            int b = prev[i];
+            int c = (i >= step) ? prev[i - step] : 0;
+            switch (filter)
+            {
+            case 1: row[i] += a; break;
+            case 2: row[i] += b; break;
+            case 3: row[i] += (a + b) / 2; break;
+            case 4: row[i] += paeth(a, b, c); break;
+            default: break;
+            }
+        }
+        memcpy(prev.data(), row, stride);
+    }
+
+    Gray img;
+    img.width = width;
+    img.height = height;
+    img.pixels.resize(width * height);
+
+    const int maxValue = (1 << depth) - 1;
+    for (int y = 0; y < height; y++)
+    {
+        const uint8_t *row = &raw[y * (stride + 1) + 1];
+        for (int x = 0; x < width; x++)
+        {
+            int s[4];
+            for (int ch = 0; ch < channels; ch++)
+            {
+                size_t bit = (x * channels + ch) * depth;
+                int v;
+                if (depth == 16)
+                    v = row[bit / 8]; // High byte is enough
+                else if (depth == 8)
+                    v = row[bit / 8];
+                else
+                    v = ((row[bit / 8] >> (8 - depth - bit % 8)) & maxValue);
+                s[ch] = (depth < 8 && colorType != 3) ? v * 255 / maxValue : v;
+            }
+
+            uint8_t lum;
+            switch (colorType)
+            {
+            case 0: lum = s[0]; break;
+            case 2: lum = luminance(s[0], s[1], s[2], 255); break;
+            case 3:
+            {
+                size_t i = s[0];
+                if (i * 3 + 2 >= palette.size())
+                    fail("PNG palette index out of range");
+                int alpha = (i < paletteAlpha.size()) ? paletteAlpha[i] : 255;
+                lum = luminance(palette[i * 3], palette[i * 3 + 1], palette[i * 3 + 2], alpha);
+                break;
+            }
+            case 4: lum = s[0] * s[1] / 255; break;
+            default: lum = luminance(s[0], s[1], s[2], s[3]); break;
+            }
+            img.pixels[y * width + x] = lum;
+        }
+    }
+    return img;
+}
+
+// ---------------------------------------------------------------------------
+// GIF
+// ---------------------------------------------------------------------------
+
+static Bytes lzwDecode(const Bytes &data, int minCodeSize, size_t pixelCount)
+{
+    const int clear = 1 << minCodeSize;
+    const int end = clear + 1;
+    uint16_t prefix[4096];
+    uint8_t suffix[4096];
+    uint8_t stack[4097];
+
+    int codeSize = minCodeSize + 1;
+    int next = end + 1;
+    int prev = -1;
+    uint8_t firstChar = 0;
+
+    for (int i = 0; i < clear; i++)
+        suffix[i] = i;
+
+    Bytes out;
+    BitReader in(data.data(), data.size());
+    while (out.size() < pixelCount)
+    {
+        if (in.pos >= in.size && in.bitCount < codeSize)
+            break; // Missing end code: keep what was decoded
+        int code = in.bits(codeSize);
+        if (code == clear)
+        {
+            codeSize = minCodeSize + 1;
+            next = end + 1;
+            prev = -1;
+            continue;
+        }
+        if (code == end)
+            break;
+
+        if (prev < 0)
+        {
+            if (code >= clear)
+                fail("invalid GIF LZW data");
+            out.push_back(code);
+            prev = code;
+            firstChar = code;
+            continue;
+        }
+
+        int in0 = code;
+        int sp = 0;
+        if (code >= next)
+        {
+            stack[sp++] = firstChar; // KwKwK case
+            code = prev;
+        }
+        while (code >= clear)
+        {
+            stack[sp++] = suffix[code];
+            code = prefix[code];
+        }
+        firstChar = code;
+        stack[sp++] = firstChar;
+        while (sp)
+            out.push_back(stack[--sp]);
+
+        if (next < 4096)
+        {
+            prefix[next] = prev;
+            suffix[next] = firstChar;
+            next++;
+            if (next == (1 << codeSize) && codeSize < 12)
+                codeSize++;
+        }
+        prev = in0;
+    }
+    out.resize(pixelCount, 0);
+    return out;
+}
+
+static std::vector<Gray> loadGif(const Bytes &file)
+{
+    if (file.size() < 13 || memcmp(file.data(), "GIF8", 4) != 0)
+        fail("not a GIF file");
+
+    size_t pos = 6;
+    auto u8 = [&]() -> int {
+        if (pos >= file.size())
+            fail("truncated GIF");
+        return file[pos++];
+    };
+    auto u16 = [&]() { int lo = u8(); return lo | (u8() << 8); };
+    auto colorTable = [&](int flags) {
+        Bytes table;
+        if (flags & 0x80)
+            for (int i = 0; i < 3 * (2 << (flags & 7)); i++)
+                table.push_back(u8());
+        return table;
+    };
+    auto subBlocks = [&]() {
+        Bytes data;
+        for (int n = u8(); n; n = u8())
+            for (int i = 0; i < n; i++)
+                data.push_back(u8());
+        return data;
+    };
+
+    const int width = u16();
+    const int height = u16();
+    int flags = u8();
+    u8(); // Background index: disposal clears to unlit instead
+    u8(); // Aspect ratio
+    Bytes globalTable = colorTable(flags);
+
+    Gray screen;
+    screen.width = width;
+    screen.height = height;
+    screen.pixels.assign(width * height, 0);
+
+    std::vector<Gray> frames;
+    int transparent = -1, disposal = 0;
+
+    for (;;)
+    {
+        int block = u8();
+        if (block == 0x3B)
+            break;
+
+        if (block == 0x21)
+        {
+            int label = u8();
+            Bytes ext = subBlocks();
+            if (label == 0xF9 && ext.size() >= 4)
+            {
+                disposal = (ext[0] >> 2) & 7;
+                transparent = (ext[0] & 1) ? ext[3] : -1;
+            }
+            continue;
+        }
+        if (block != 0x2C)
+            fail("unexpected GIF block");
+
+        int left = u16(), top = u16(), w = u16(), h = u16();
+        int imageFlags = u8();
+        Bytes localTable = colorTable(imageFlags);
+        const Bytes &table = localTable.empty() ? globalTable : localTable;
+        int minCodeSize = u8();
+        if (minCodeSize < 2 || minCodeSize > 8)
+            fail("invalid GIF LZW code size");
+        Bytes indices = lzwDecode(subBlocks(), minCodeSize, static_cast<size_t>(w) * h);
+
+        Gray before = screen; // For disposal method 3
+
+        // Interlaced rows come in four passes
+        std::vector<int> rowOrder;
+        if (imageFlags & 0x40)
+        {
+            static const int start[4] = {0, 4, 2, 1}, inc[4] = {8, 8, 4, 2};
+            for (int p = 0; p < 4; p++)
+                for (int y = start[p]; y < h; y += inc[p])
+                    rowOrder.push_back(y);
+        }
+        else
+        {
+            for (int y = 0; y < h; y++)
+                rowOrder.push_back(y);
+        }
+
+        for (int r = 0; r < h; r++)
+        {
+            int y = top + rowOrder[r];
+            for (int x = 0; x < w; x++)
+            {
+                int idx = indices[r * w + x];
+                if (idx == transparent || y >= height || left + x >= width)
+                    continue;
+                if (static_cast<size_t>(idx) * 3 + 2 >= table.size())
+                    fail("GIF color index out of range");
+                screen.pixels[y * width + left + x] = luminance(table[idx * 3], table[idx * 3 + 1], table[idx * 3 + 2], 255);
+            }
+        }
+        frames.push_back(screen);
+
+        if (disposal == 2)
+        {
+            for (int y = top; y < top + h && y < height; y++)
+                for (int x = left; x < left + w && x < width; x++)
+                    screen.pixels[y * width + x] = 0;
+        }
+        else if (disposal == 3)
+        {
+            screen = before;
+        }
+        transparent = -1;
+        disposal = 0;
+    }
+
+    if (frames.empty())
+        fail("GIF has no image");
+    return frames;
+}
+
+// ---------------------------------------------------------------------------
+// Column bytes and encoding
+// ---------------------------------------------------------------------------
+
+static Bytes toColumns(const Gray &img, const Options &opt, int &bands)
+{
+    // Pad to whole 8-row bands with unlit rows (also when inverted)
+    bands = (img.height + 7) / 8;
+    Bytes gray(img.width * bands * 8, 0);
+    for (int i = 0; i < img.width * img.height; i++)
+        gray[i] = opt.invert ? 255 - img.pixels[i] : img.pixels[i];
+
+    Bytes cols(img.width * bands);
+    for (int b = 0; b < bands; b++)
+    {
+        for (int x = 0; x < img.width; x += 8)
+        {
+            const uint8_t *block = &gray[b * 8 * img.width + x];
+            int n = (img.width - x < 8) ? img.width - x : 8;
+            uint8_t out[8];
+            if (opt.dither)
+                SBK_MAX72xxDither8x8(block, img.width, n, out);
+            else
+            {
+                for (int c = 0; c < n; c++)
+                {
+                    out[c] = 0;
+                    for (int r = 0; r < 8; r++)
+                        if (block[r * img.width + c] >= opt.threshold)
+                            out[c] |= SBK_MAX72xxRowMask[r];
+                }
+            }
+            memcpy(&cols[b * img.width + x], out, n);
+        }
+    }
+
+    return cols;
+}
+
+static Bytes encodeRle(const Bytes &in)
+{
+    // Format decoded by SBK_MAX72xxUnpack(): see SBK_MAX72xxAsset.h
+    Bytes out;
+    size_t i = 0;
+    while (i < in.size())
+    {
+        size_t run = 1;
+        while (i + run < in.size() && in[i + run] == in[i] && run < 129)
+            run++;
+        if (run >= 2)
+        {
+            out.push_back(static_cast<uint8_t>(run + 126));
+            out.push_back(in[i]);
+            i += run;
+            continue;
+        }
+
+        size_t start = i;
+        while (i < in.size() && i - start < 128 && !(i + 1 < in.size() && in[i + 1] == in[i]))
+            i++;
+        out.push_back(static_cast<uint8_t>(i - start - 1));
+        out.insert(out.end(), in.begin() + start, in.begin() + i);
+    }
+    return out;
+}
+
+static void printArray(const char *name, const Bytes &data)
+{
+    printf("const uint8_t %s[] PROGMEM = {", name);
+    for (size_t i = 0; i < data.size(); i++)
+        printf("%s0x%02X", (i == 0) ? "\n    " : (i % 16) ? ", " : ",\n    ", data[i]);
+    printf("\n};\n");
+}
+
+static void writeFrames(const char *path, const char *name, const std::vector<Gray> &images, const Options &opt)
+{
+    int bands = 1;
+    Bytes data, prev;
+    size_t raw = 0;
+
+    for (const Gray &img : images)
+    {
+        Bytes cols = toColumns(img, opt, bands);
+        raw += cols.size();
+
+        if (opt.delta && !prev.empty())
+        {
+            Bytes diff(cols.size());
+            for (size_t i = 0; i < cols.size(); i++)
+                diff[i] = cols[i] ^ prev[i];
+            prev = cols;
+            cols = diff;
+        }
+        else
+        {
+            prev = cols;
+        }
+
+        Bytes encoded = opt.rle ? encodeRle(cols) : cols;
+        data.insert(data.end(), encoded.begin(), encoded.end());
+    }
+
+    const char *format = opt.delta ? "RLE + delta, decode frames with SBK_MAX72xxUnpack(..., xorInto = true after the first)"
+                         : opt.rle ? "RLE, decode frames with SBK_MAX72xxUnpack()"
+                                   : "raw column bytes";
+    printf("// Generated by assetCompiler from %s\n#pragma once\n", path);
+    printf("// %s: %d x %d, %zu frame(s), %s\n", path, images[0].width, images[0].height, images.size(), format);
+    printf("// Band-major: band b of column x is byte b * %s_width + x, frames back to back\n", name);
+    printf("const uint16_t %s_width = %d;\n", name, images[0].width);
+    printf("const uint8_t %s_bands = %d;\n", name, bands);
+    printf("const uint16_t %s_frames = %zu;\n", name, images.size());
+    printArray(name, data);
+
+    fprintf(stderr, "%s: %zu bytes of flash (%zu uncompressed)\n", name, data.size(), raw);
+}
+
+// ---------------------------------------------------------------------------
+// BDF
+// ---------------------------------------------------------------------------
+
+static void writeFont(const char *path, const char *name, const Bytes &file, const Options &opt)
+{
+    std::string text(file.begin(), file.end());
+    size_t pos = 0;
+    auto nextLine = [&](std::string &line) {
+        if (pos >= text.size())
+            return false;
+        size_t eol = text.find('\n', pos);
+        if (eol == std::string::npos)
+            eol = text.size();
+        line = text.substr(pos, eol - pos);
+        if (!line.empty() && line.back() == '\r')
+            line.pop_back();
+        pos = eol + 1;
+        return true;
+    };
+    auto starts = [](const std::string &line, const char *key) { return line.compare(0, strlen(key), key) == 0; };
+
+    int cellW = 0, cellH = 0, cellX = 0, cellY = 0, ascent = -1;
+    struct Glyph
+    {
+        int code = -1, w = 0, h = 0, xoff = 0, yoff = 0;
+        std::vector<uint32_t> rows;
+    };
+    std::vector<Glyph> glyphs;
+    Glyph g;
+    bool inBitmap = false;
+
+    std::string line;
+    while (nextLine(line))
+    {
+        if (inBitmap)
+        {
+            if (starts(line, "ENDCHAR"))
+            {
+                inBitmap = false;
+                bool wanted = opt.chars.empty() ? (g.code >= opt.first && g.code <= opt.last)
+                                                : std::find(opt.chars.begin(), opt.chars.end(), g.code) != opt.chars.end();
+                if (wanted && g.code >= 0 && g.code <= 0xFFFF)
+                    glyphs.push_back(g);
+                g = Glyph();
+            }
+            else
+            {
+                g.rows.push_back(strtoul(line.c_str(), nullptr, 16));
+            }
+        }
+        else if (starts(line, "FONTBOUNDINGBOX"))
+            sscanf(line.c_str(), "FONTBOUNDINGBOX %d %d %d %d", &cellW, &cellH, &cellX, &cellY);
+        else if (starts(line, "FONT_ASCENT"))
+            sscanf(line.c_str(), "FONT_ASCENT %d", &ascent);
+        else if (starts(line, "ENCODING"))
+            sscanf(line.c_str(), "ENCODING %d", &g.code);
+        else if (starts(line, "BBX"))
+            sscanf(line.c_str(), "BBX %d %d %d %d", &g.w, &g.h, &g.xoff, &g.yoff);
+        else if (starts(line, "BITMAP"))
+            inBitmap = true;
+    }
+
+    if (!cellW || !cellH)
+        fail("BDF has no FONTBOUNDINGBOX: ", path);
+    if (ascent < 0)
+        ascent = cellH + cellY;
+    if (cellH > 8)
+        fprintf(stderr, "%s: glyphs are %d rows tall, rows past 8 are dropped\n", path, cellH);
+
+    // Sorted by codepoint, first definition kept
+    std::sort(glyphs.begin(), glyphs.end(), [](const Glyph &a, const Glyph &b) { return a.code < b.code; });
+    glyphs.erase(std::unique(glyphs.begin(), glyphs.end(), [](const Glyph &a, const Glyph &b) { return a.code == b.code; }),
+                 glyphs.end());
+    if (glyphs.empty())
+        fail("no glyph selected in ", path);
+
+    const int first = glyphs.front().code;
+    const int last = glyphs.back().code;
+
+    // A range font when the selection fits one (blank cells for missing characters) and is
+    // not larger, otherwise a sparse font: only the glyphs, found by binary search over their
+    // codepoints (2 extra bytes each)
+    const bool sparse = !opt.chars.empty() || last > 0xFF ||
+                        static_cast<size_t>(last - first + 1) * cellW > glyphs.size() * (cellW + 2);
+    const size_t cells = sparse ? glyphs.size() : last - first + 1;
+
+    Bytes columns(cells * cellW, 0);
+    for (size_t i = 0; i < glyphs.size(); i++)
+    {
+        const Glyph &gl = glyphs[i];
+        const size_t cell = sparse ? i : gl.code - first;
+        int rowBits = ((gl.w + 7) / 8) * 8;
+        for (int py = 0; py < static_cast<int>(gl.rows.size()) && py < gl.h; py++)
+        {
+            int row = ascent - (gl.yoff + gl.h) + py;
+            if (row < 0 || row >= 8)
+                continue;
+            for (int px = 0; px < gl.w; px++)
+            {
+                int col = gl.xoff - cellX + px;
+                if (col < 0 || col >= cellW || !((gl.rows[py] >> (rowBits - 1 - px)) & 1))
+                    continue;
+                columns[cell * cellW + col] |= SBK_MAX72xxRowMask[row];
+            }
+        }
+    }
+
+    std::string colsName = std::string(name) + "_columns";
+    std::string cpsName = std::string(name) + "_codepoints";
+    std::string fallback = opt.fallback.empty() ? "nullptr" : "&" + opt.fallback;
+
+    printf("// Generated by assetCompiler from %s\n#pragma once\n", path);
+    printf("// %s: %d x %d cells, %zu glyphs U+%04X-U+%04X (%s)\n", path, cellW, cellH, glyphs.size(), first, last,
+           sparse ? "sparse" : "range");
+    printf("#include <SBK_MAX72xxFont.h>\n");
+    if (!opt.fallback.empty())
+        printf("extern const SBK_MAX72xxFont %s;\n", opt.fallback.c_str());
+    printArray(colsName.c_str(), columns);
+
+    size_t flash = columns.size();
+    if (sparse)
+    {
+        printf("const uint16_t %s[] PROGMEM = {", cpsName.c_str());
+        for (size_t i = 0; i < glyphs.size(); i++)
+            printf("%s0x%04X", (i == 0) ? "\n    " : (i % 8) ? ", " : ",\n    ", glyphs[i].code);
+        printf("\n};\n");
+        printf("const SBK_MAX72xxFont %s = {%s, 0, 0, %d, %d, %s, %zu, %s};\n", name, colsName.c_str(), cellW,
+               opt.spacing, cpsName.c_str(), glyphs.size(), fallback.c_str());
+        flash += glyphs.size() * 2;
+    }
+    else
+    {
+        printf("const SBK_MAX72xxFont %s = {%s, 0x%02X, 0x%02X, %d, %d, nullptr, 0, %s};\n", name, colsName.c_str(),
+               first, last, cellW, opt.spacing, fallback.c_str());
+    }
+
+    fprintf(stderr, "%s: %zu bytes of flash (%zu glyphs)\n", name, flash, glyphs.size());
+}
+
+// ---------------------------------------------------------------------------
+
+int main(int argc, char **argv)
+{
+    Options opt;
+    const char *input = nullptr;
+    const char *name = nullptr;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--threshold" && hasValue)
+            opt.threshold = atoi(argv[++i]);
+        else if (arg == "--dither")
+            opt.dither = true;
+        else if (arg == "--invert")
+            opt.invert = true;
+        else if (arg == "--rle")
+            opt.rle = true;
+        else if (arg == "--delta")
+            opt.delta = opt.rle = true;
+        else if (arg == "--range" && hasValue)
+        {
+            char *dash;
+            opt.first = strtol(argv[++i], &dash, 0);
+            opt.last = (*dash == '-') ? strtol(dash + 1, nullptr, 0) : opt.first;
+        }
+        else if (arg == "--spacing" && hasValue)
+            opt.spacing = atoi(argv[++i]);
+        else if (arg == "--chars" && hasValue)
+        {
+            const char *text = argv[++i];
+            while (uint16_t c = SBK_MAX72xxUtf8Next(text))
+                opt.chars.push_back(c);
+        }
+        else if (arg == "--fallback" && hasValue)
+            opt.fallback = argv[++i];
+        else if (arg[0] != '-' && !input)
+            input = argv[i];
+        else if (arg[0] != '-' && !name)
+            name = argv[i];
+        else
+            fail("unknown option ", argv[i]);
+    }
+
+    if (!input || !name)
+    {
+        fprintf(stderr, "usage: assetCompiler [options] input.(png|gif|bdf) name > asset.h\n");
+        return 1;
+    }
+
+    std::string ext = strrchr(input, '.') ? strrchr(input, '.') : "";
+    for (char &c : ext)
+        c = tolower(c);
+
+    Bytes file = readFile(input);
+    if (ext == ".png")
+        writeFrames(input, name, std::vector<Gray>(1, loadPng(file)), opt);
+    else if (ext == ".gif")
+        writeFrames(input, name, loadGif(file), opt);
+    else if (ext == ".bdf")
+        writeFont(input, name, file, opt);
+    else
+        fail("unknown input type: ", input);
+    return 0;
+}
@@ -0,0 +1,108 @@
+/**
+ * @file captureReplay.cpp
+ * @brief Host tool: replay a SBK_MAX72xxCapture text log into the chain simulator.
+ *
+ * Reads the output of printFrames() (or of a streaming capture saved to Serial or an SD
+ * card file): one `<timeUs> <hex bytes...>` line per chip-select frame, `#` lines ignored.
+ * The frames are loaded into a SBK_MAX72xxCapture, so the latched registers and the VCD
+ * waveform come out exactly as printRegisters() and writeVCD() print them on the target.
+ *
+ * Build (against the host Arduino shim of extras/test):
+ *   g++ -std=gnu++11 -O2 -I../../src -I../test/shim captureReplay.cpp
+ *       ../../src/SBK_MAX72xxCapture.cpp ../test/shim/shim.cpp -o captureReplay
+ * Usage: captureReplay [options] [capture.txt]   (standard input when no file is given)
+ *   --vcd           Write the CS/CLK/DIN waveform instead of the registers
+ *   --clock HZ      SPI clock used for the VCD bit timing (default 1000000)
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ * @version 2.0.4
+ * @license MIT
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "SBK_MAX72xxCapture.h"
+
+typedef SBK_MAX72xxCapture::Frame Frame;
+
+// One printFrame() line; false for comments, blank lines and malformed input
+static bool parseFrame(const char *line, Frame &frame)
+{
+    char *end;
+    while (*line == ' ' || *line == '\t')
+        line++;
+    if (*line == '#' || *line < '0' || *line > '9')
+        return false;
+
+    frame.timeUs = strtoul(line, &end, 10);
+    frame.len = 0;
+    for (line = end; frame.len < SBK_MAX72xxCapture::maxFrameBytes; line = end)
+    {
+        unsigned long value = strtoul(line, &end, 16);
+        if (end == line || value > 0xFF)
+            break;
+        frame.data[frame.len++] = static_cast<uint8_t>(value);
+    }
+    return frame.len > 0;
+}
+
+int main(int argc, char **argv)
+{
+    bool vcd = false;
+    uint32_t clockHz = 1000000;
+    const char *path = nullptr;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "--vcd"))
+            vcd = true;
+        else if (!strcmp(argv[i], "--clock") && i + 1 < argc)
+            clockHz = strtoul(argv[++i], nullptr, 10);
+        else if (argv[i][0] != '-' && !path)
+            path = argv[i];
+        else
+        {
+            fprintf(stderr, "usage: %s [--vcd] [--clock HZ] [capture.txt]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    FILE *f = path ? fopen(path, "r") : stdin;
+    if (!f)
+    {
+        perror(path);
+        return 1;
+    }
+
+    std::vector<Frame> frames;
+    char line[256];
+    Frame frame;
+    while (fgets(line, sizeof(line), f))
+    {
+        if (parseFrame(line, frame))
+            frames.push_back(frame);
+    }
+    if (path)
+        fclose(f);
+
+    if (frames.size() > 0xFFFF)
+    {
+        fprintf(stderr, "%s: keeping the last 65535 of %u frames\n", path ? path : "stdin",
+                static_cast<unsigned>(frames.size()));
+        frames.erase(frames.begin(), frames.end() - 0xFFFF);
+    }
+
+    SBK_MAX72xxCapture capture(static_cast<uint16_t>(frames.size() ? frames.size() : 1));
+    for (const Frame &fr : frames)
+        capture.record(fr);
+
+    Print out; // The shim's Print writes to standard output
+    if (vcd)
+        capture.writeVCD(out, clockHz);
+    else
+        capture.printRegisters(out);
+    return 0;
+}
@@ -0,0 +1,102 @@
+/**
+ * @file ditherImage.cpp
+ * @brief Host tool: dither a grayscale PGM image into a PROGMEM column-byte array.
+ *
+ * Uses the same Bayer thresholds as SBK_MAX72xxDither.h, so the output matches what
+ * SBK_MAX72xxDitherImage() shows on the device. The array is band-major (band b of
+ * column x is byte b × width + x), ready for the strip constructor of SBK_MAX72xxCanvas.
+ *
+ * Build: g++ -std=c++11 -I../../src ditherImage.cpp -o ditherImage
+ * Usage: ditherImage image.pgm name > image.h
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ * @version 2.0.4
+ * @license MIT
+ */
+
+#include <cstdio>
+#include <vector>
+#include "SBK_MAX72xxDither.h"
+
+static bool readToken(FILE *f, int &value)
+{
+    int ch;
+    while ((ch = fgetc(f)) != EOF)
+    {
+        if (ch == '#')
+        {
+            while ((ch = fgetc(f)) != EOF && ch != '\n')
+            {
+            }
+        }
+        else if (ch > ' ')
+        {
+            ungetc(ch, f);
+            return fscanf(f, "%d", &value) == 1;
+        }
+    }
+    return false;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc != 3)
+    {
+        fprintf(stderr, "usage: %s image.pgm name > image.h\n", argv[0]);
+        return 1;
+    }
+
+    FILE *f = fopen(argv[1], "rb");
+    if (!f)
+    {
+        perror(argv[1]);
+        return 1;
+    }
+
+    // Binary PGM: "P5 width height maxval" then one byte per pixel
+    int width, height, maxval;
+    if (fgetc(f) != 'P' || fgetc(f) != '5' || !readToken(f, width) || !readToken(f, height) ||
+        !readToken(f, maxval) || width <= 0 || height <= 0 || maxval <= 0 || maxval > 255)
+    {
+        fprintf(stderr, "%s: not an 8-bit binary PGM (P5) image\n", argv[1]);
+        return 1;
+    }
+    fgetc(f); // Single whitespace before the pixels
+
+    // Pad to whole 8-row bands with black rows
+    const int bands = (height + 7) / 8;
+    std::vector<uint8_t> gray(width * bands * 8, 0);
+    if (fread(gray.data(), 1, width * height, f) != static_cast<size_t>(width * height))
+    {
+        fprintf(stderr, "%s: truncated image\n", argv[1]);
+        return 1;
+    }
+    fclose(f);
+
+    for (uint8_t &g : gray)
+        g = g * 255 / maxval;
+
+    std::vector<uint8_t> strip(width * bands);
+    for (int b = 0; b < bands; b++)
+    {
+        for (int x = 0; x < width; x += 8)
+        {
+            uint8_t cols[8];
+            int n = (width - x < 8) ? width - x : 8;
+            SBK_MAX72xxDither8x8(&gray[b * 8 * width + x], width, n, cols);
+            for (int c = 0; c < n; c++)
+                strip[b * width + x + c] = cols[c];
+        }
+    }
+
+    printf("// %s: %d x %d, %d band(s), Bayer 8x8 dithered, band-major column bytes\n", argv[1], width, height,
+           bands);
+    printf("const uint16_t %s_width = %d;\n", argv[2], width);
+    printf("const uint8_t %s_bands = %d;\n", argv[2], bands);
+    printf("const uint8_t %s[] PROGMEM = {", argv[2]);
+    for (size_t i = 0; i < strip.size(); i++)
+        printf("%s0x%02X", (i == 0) ? "\n    " : (i % 16) ? ", " : ",\n    ", strip[i]);
+    printf("\n};\n");
+    return 0;
+}
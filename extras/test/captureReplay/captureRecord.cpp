@@ -0,0 +1,116 @@
+/**
+ * @file captureRecord.cpp
+ * @brief Recorder half of the captureReplay test: a driver's traffic as a text log.
+ *
+ * Random drawing and control calls go through SBK_MAX72xxHard with a streaming capture
+ * writing printFrame() lines to a file, as a sketch would to Serial or an SD card. The
+ * shim latches the same bytes into its own SBK_MAX72xxChainSim, whose registers are
+ * printed on standard output in the printRegisters() layout. Replaying the log with
+ * extras/captureReplay must print the same text (the Makefile diffs both).
+ *
+ * Build and run: make -C extras/test check
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ * @version 2.0.4
+ * @license MIT
+ */
+
+#include <cstdio>
+#include "Arduino.h"
+#include "ShimBus.h"
+#include "SBK_MAX72xxCapture.h"
+#include "SBK_MAX72xxHard.h"
+
+static constexpr uint8_t csPin = 10;
+static constexpr uint8_t devsNum = 5;
+
+/**
+ * @brief Print into a stdio file.
+ */
+class FilePrint : public Print
+{
+public:
+    explicit FilePrint(FILE *f) : _f(f) {}
+    size_t write(uint8_t c) override { return fputc(c, _f) == EOF ? 0 : 1; }
+
+private:
+    FILE *_f;
+};
+
+static uint32_t rng = 0x2545F491;
+
+static uint8_t next(uint16_t range)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng % range;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc != 2)
+    {
+        fprintf(stderr, "usage: %s capture.txt > registers.txt\n", argv[0]);
+        return 1;
+    }
+    FILE *f = fopen(argv[1], "w");
+    if (!f)
+    {
+        perror(argv[1]);
+        return 1;
+    }
+
+    SBK_MAX72xxChainSim chain(devsNum);
+    shimAttach(csPin, &chain);
+
+    FilePrint log(f);
+    SBK_MAX72xxCapture capture(log);
+    SBK_MAX72xxHard driver(csPin, devsNum);
+    driver.setCapture(&capture);
+    driver.begin();
+
+    for (uint16_t i = 0; i < 400; i++)
+    {
+        uint8_t dev = next(devsNum);
+        switch (next(6))
+        {
+        case 0:
+            driver.setBrightness(dev, next(16));
+            break;
+        case 1:
+            driver.setShutdown(dev, next(4) == 0);
+            break;
+        case 2:
+            driver.show(dev);
+            break;
+        case 3:
+            driver.show();
+            break;
+        default:
+            driver.setCol(dev, next(8), next(256));
+            break;
+        }
+    }
+    driver.show();
+    fclose(f);
+
+    // Same layout as SBK_MAX72xxCapture::printRegisters()
+    for (uint8_t devIdx = 0; devIdx < devsNum; devIdx++)
+    {
+        printf("dev %u:", devIdx);
+        for (uint8_t opcode = 0x01; opcode < SBK_MAX72xxChainSim::registersNum; opcode++)
+        {
+            if (opcode == 0x0D || opcode == 0x0E)
+                continue;
+            printf(opcode == 0x09 ? " | " : " ");
+            if (chain.written(devIdx, opcode))
+                printf("%02X", chain.reg(devIdx, opcode));
+            else
+                printf("--");
+        }
+        printf("\n");
+    }
+    return 0;
+}
@@ -0,0 +1,175 @@
+/**
+ * @file FlushSubject.h
+ * @brief Driver operations replayed by the flush equivalence harness, and the driver adapter.
+ *
+ * Each flush variant (reference, chain-wide, wire-order buffer) is compiled into its own
+ * translation unit with its own class names, so the harness only sees FlushSubject. The
+ * Linux driver runs in fake-device mode and latches its frames into its own chain.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ * @version 2.0.4
+ * @license MIT
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "SBK_MAX72xxChainSim.h"
+
+/**
+ * @brief One draw or control call, with its arguments.
+ */
+struct FlushOp
+{
+    enum Kind : uint8_t
+    {
+        SetLed,
+        SetCol,
+        SetLedFast,
+        TogglePixel,
+        WritePixelSpan,
+        ToggleLed,
+        Invert,
+        InvertAll,
+        WriteMasked,
+        ClearDev,
+        ClearAll,
+        Show,
+        ShowDev,
+        SetBrightness,
+        SetBrightnessAll,
+        SetShutdown,
+        SetDecodeMode,
+        TestMode,
+        KindsNum
+    };
+
+    Kind kind;
+    uint8_t dev;
+    uint8_t row;
+    uint8_t col;
+    uint8_t value;
+    uint8_t mask;
+    uint8_t levels[8];
+};
+
+/**
+ * @brief A driver under test, behind a virtual interface.
+ */
+class FlushSubject
+{
+public:
+    virtual ~FlushSubject() {}
+    virtual void begin() = 0;
+    virtual void apply(const FlushOp &op) = 0;
+    virtual uint8_t getCol(uint8_t dev, uint8_t col) const = 0;
+
+    /**
+     * @brief Chain the driver latches into by itself, nullptr when it writes through the shim.
+     */
+    virtual const SBK_MAX72xxChainSim *chain() const { return nullptr; }
+};
+
+/**
+ * @brief FlushSubject over any SBK_MAX72xx driver class.
+ */
+template <typename Driver>
+class FlushDriver : public FlushSubject
+{
+public:
+    template <typename... Args>
+    explicit FlushDriver(Args... args) : _driver(args...) {}
+
+    void begin() override { _driver.begin(); }
+
+    uint8_t getCol(uint8_t dev, uint8_t col) const override { return _driver.getCol(dev, col); }
+
+    void apply(const FlushOp &op) override
+    {
+        const uint8_t devsNum = _driver.devsNum();
+        const uint8_t dev = op.dev % devsNum; // The fast API asserts its arguments
+        const uint8_t row = op.row % 8;
+        const uint8_t col = op.col % 8;
+
+        switch (op.kind)
+        {
+        case FlushOp::SetLed:
+            _driver.setLed(op.dev, op.row, op.col, op.value & 1); // Out of range on purpose sometimes
+            break;
+        case FlushOp::SetCol:
+            _driver.setCol(op.dev, op.col, op.value);
+            break;
+        case FlushOp::SetLedFast:
+            _driver.setLedFast(dev, row, col, op.value & 1);
+            break;
+        case FlushOp::TogglePixel:
+            _driver.togglePixel(dev, row, col);
+            break;
+        case FlushOp::WritePixelSpan:
+            _driver.writePixelSpan(dev, row, col, op.value % (8 - col + 1), op.mask & 1);
+            break;
+        case FlushOp::ToggleLed:
+            _driver.toggleLed(op.dev, op.row, op.col);
+            break;
+        case FlushOp::Invert:
+            _driver.invert(op.dev);
+            break;
+        case FlushOp::InvertAll:
+            _driver.invertAll();
+            break;
+        case FlushOp::WriteMasked:
+            _driver.writeMasked(op.dev, op.col, op.mask, op.value);
+            break;
+        case FlushOp::ClearDev:
+            _driver.clear(op.dev);
+            break;
+        case FlushOp::ClearAll:
+            _driver.clear();
+            break;
+        case FlushOp::Show:
+            _driver.show();
+            break;
+        case FlushOp::ShowDev:
+            _driver.show(op.dev);
+            break;
+        case FlushOp::SetBrightness:
+            _driver.setBrightness(op.dev, op.value);
+            break;
+        case FlushOp::SetBrightnessAll:
+            _driver.setBrightness(op.levels);
+            break;
+        case FlushOp::SetShutdown:
+            _driver.setShutdown(op.dev, op.value & 1);
+            break;
+        case FlushOp::SetDecodeMode:
+            _driver.setDecodeMode(op.dev, op.value);
+            break;
+        case FlushOp::TestMode:
+            _driver.testMode(op.dev, op.value & 1);
+            break;
+        default:
+            break;
+        }
+    }
+
+protected:
+    Driver _driver;
+};
+
+/**
+ * @brief Which driver class a variant builds.
+ */
+enum class FlushDriverKind : uint8_t
+{
+    Hard,
+    Soft
+};
+
+// Implemented by each variant translation unit (flushVariant.cpp built with different flags)
+FlushSubject *newReferenceSubject(FlushDriverKind kind, uint8_t csPin, uint8_t devsNum);
+FlushSubject *newChainWideSubject(FlushDriverKind kind, uint8_t csPin, uint8_t devsNum);
+FlushSubject *newWireOrderSubject(FlushDriverKind kind, uint8_t csPin, uint8_t devsNum);
+
+// SBK_MAX72xxLinux in fake-device mode (linuxSubject.cpp)
+FlushSubject *newLinuxSubject(uint8_t devsNum);
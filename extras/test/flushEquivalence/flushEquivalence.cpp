@@ -0,0 +1,355 @@
+/**
+ * @file flushEquivalence.cpp
+ * @brief Randomized differential test of the driver flush paths against the reference one.
+ *
+ * Replays the same random draw/control sequence through three builds of SBK_MAX72xxHard and
+ * SBK_MAX72xxSoft: the reference one-device-at-a-time flush (SBK_MAX72XX_REFERENCE_FLUSH),
+ * the chain-wide digit frames, and the wire-order buffer (SBK_MAX72XX_WIRE_ORDER_BUFFER),
+ * and through SBK_MAX72xxLinux in fake-device mode, which builds the same chain-wide frames.
+ * Each driver writes into its own SBK_MAX72xxChainSim (through the shim, or the Linux
+ * driver's fake chain), and the latched registers of every chain must match the reference
+ * after every call. A failing sequence is shrunk to a minimal repro before being printed.
+ * The bytes each path put on the wire are reported at the end.
+ *
+ * Build and run: make -C extras/test check
+ * Usage: flushEquivalence [--seeds N] [--first S] [--sabotage]
+ *        --sabotage corrupts 0xA5 bytes on the chain-wide chain, to check that the
+ *        harness catches and shrinks a wire fault (it then succeeds only if it does).
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ * @version 2.0.4
+ * @license MIT
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "FlushSubject.h"
+#include "ShimBus.h"
+
+static constexpr uint8_t variantsNum = 4;
+static const char *const variantNames[variantsNum] = {"reference", "chain-wide", "wire-order", "linux"};
+static constexpr uint8_t firstCsPin = 10; // Variant v uses CS pin firstCsPin + v
+static constexpr size_t opsPerSequence = 80;
+static constexpr size_t atBegin = static_cast<size_t>(-1);
+
+struct RunResult
+{
+    bool ok;
+    size_t failAt;      // Index of the call after which the chains differ (ops.size() = final check)
+    uint8_t failVariant;
+    uint32_t bytes[variantsNum];
+};
+
+static uint32_t rngState = 1;
+
+static uint32_t nextRandom()
+{
+    // xorshift32: the same seed gives the same sequence on every host
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 17;
+    rngState ^= rngState << 5;
+    return rngState;
+}
+
+static FlushOp randomOp(uint8_t devsNum)
+{
+    FlushOp op;
+    memset(&op, 0, sizeof(op));
+
+    // Drawing is common, flushing regular, control registers rare
+    uint32_t pick = nextRandom() % 100;
+    if (pick < 55)
+        op.kind = static_cast<FlushOp::Kind>(FlushOp::SetLed + nextRandom() % (FlushOp::WriteMasked + 1));
+    else if (pick < 80)
+        op.kind = (nextRandom() % 4) ? FlushOp::Show : FlushOp::ShowDev;
+    else if (pick < 88)
+        op.kind = (nextRandom() % 3) ? FlushOp::ClearDev : FlushOp::ClearAll;
+    else
+        op.kind = static_cast<FlushOp::Kind>(FlushOp::SetBrightness + nextRandom() % (FlushOp::KindsNum - FlushOp::SetBrightness));
+
+    // Mostly valid coordinates, with the odd out-of-range one for the checked API
+    op.dev = (nextRandom() % 16) ? nextRandom() % devsNum : devsNum + nextRandom() % 3;
+    op.row = (nextRandom() % 16) ? nextRandom() % 8 : 8;
+    op.col = (nextRandom() % 16) ? nextRandom() % 8 : 8;
+    op.value = nextRandom();
+    op.mask = nextRandom();
+    for (uint8_t &level : op.levels)
+        level = nextRandom();
+    return op;
+}
+
+static FlushSubject *newSubject(uint8_t variant, FlushDriverKind kind, uint8_t devsNum)
+{
+    const uint8_t csPin = firstCsPin + variant;
+    if (variant == 0)
+        return newReferenceSubject(kind, csPin, devsNum);
+    if (variant == 1)
+        return newChainWideSubject(kind, csPin, devsNum);
+    if (variant == 2)
+        return newWireOrderSubject(kind, csPin, devsNum);
+    return newLinuxSubject(devsNum);
+}
+
+static RunResult run(const std::vector<FlushOp> &ops, FlushDriverKind kind, uint8_t devsNum, bool sabotage)
+{
+    RunResult result;
+    memset(&result, 0, sizeof(result));
+    result.ok = true;
+
+    shimReset();
+    const SBK_MAX72xxChainSim *chains[variantsNum];
+    SBK_MAX72xxChainSim *shimChains[variantsNum] = {nullptr};
+    FlushSubject *subjects[variantsNum];
+    for (uint8_t v = 0; v < variantsNum; v++)
+    {
+        subjects[v] = newSubject(v, kind, devsNum);
+        chains[v] = subjects[v]->chain();
+        if (!chains[v])
+        {
+            shimChains[v] = new SBK_MAX72xxChainSim(devsNum);
+            shimAttach(firstCsPin + v, shimChains[v]);
+            chains[v] = shimChains[v];
+        }
+    }
+    if (sabotage)
+        shimSabotage(firstCsPin + 1, 0xA5, 0xA4);
+
+    auto check = [&](size_t at) {
+        for (uint8_t v = 1; v < variantsNum && result.ok; v++)
+        {
+            if (!chains[0]->sameRegisters(*chains[v]))
+            {
+                result.ok = false;
+                result.failAt = at;
+                result.failVariant = v;
+            }
+        }
+    };
+
+    for (uint8_t v = 0; v < variantsNum; v++)
+        subjects[v]->begin();
+    check(atBegin);
+
+    for (size_t i = 0; i < ops.size() && result.ok; i++)
+    {
+        for (uint8_t v = 0; v < variantsNum; v++)
+            subjects[v]->apply(ops[i]);
+        check(i);
+    }
+
+    if (result.ok)
+    {
+        // Once flushed, every chain shows exactly its driver's buffer
+        FlushOp show;
+        memset(&show, 0, sizeof(show));
+        show.kind = FlushOp::Show;
+        for (uint8_t v = 0; v < variantsNum && result.ok; v++)
+        {
+            subjects[v]->apply(show);
+            for (uint8_t dev = 0; dev < devsNum && result.ok; dev++)
+            {
+                for (uint8_t col = 0; col < 8; col++)
+                {
+                    if (chains[v]->reg(dev, 1 + col) != subjects[v]->getCol(dev, col) ||
+                        subjects[v]->getCol(dev, col) != subjects[0]->getCol(dev, col))
+                    {
+                        result.ok = false;
+                        result.failAt = ops.size();
+                        result.failVariant = v;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    for (uint8_t v = 0; v < variantsNum; v++)
+    {
+        result.bytes[v] = chains[v]->bytes();
+        delete subjects[v];
+        delete shimChains[v];
+    }
+    shimReset();
+    return result;
+}
+
+static std::vector<FlushOp> shrink(std::vector<FlushOp> ops, FlushDriverKind kind, uint8_t devsNum, bool sabotage)
+{
+    // Calls after the first divergence can't matter
+    RunResult first = run(ops, kind, devsNum, sabotage);
+    if (first.failAt != atBegin && first.failAt + 1 < ops.size())
+        ops.resize(first.failAt + 1);
+
+    // Delta debugging: drop ever smaller chunks while the sequence still fails
+    for (size_t chunk = ops.size() / 2; chunk >= 1; chunk /= 2)
+    {
+        bool removed = true;
+        while (removed)
+        {
+            removed = false;
+            for (size_t start = 0; start < ops.size();)
+            {
+                std::vector<FlushOp> candidate(ops.begin(), ops.begin() + start);
+                if (start + chunk < ops.size())
+                    candidate.insert(candidate.end(), ops.begin() + start + chunk, ops.end());
+
+                if (!run(candidate, kind, devsNum, sabotage).ok)
+                {
+                    ops.swap(candidate);
+                    removed = true;
+                }
+                else
+                {
+                    start += chunk;
+                }
+            }
+        }
+    }
+    return ops;
+}
+
+static void printOp(const FlushOp &op)
+{
+    static const char *const names[FlushOp::KindsNum] = {
+        "setLed", "setCol", "setLedFast", "togglePixel", "writePixelSpan", "toggleLed",
+        "invert", "invertAll", "writeMasked", "clear", "clear", "show", "show",
+        "setBrightness", "setBrightness", "setShutdown", "setDecodeMode", "testMode"};
+
+    printf("  %s(", names[op.kind]);
+    switch (op.kind)
+    {
+    case FlushOp::SetLed:
+    case FlushOp::SetLedFast:
+        printf("%u, %u, %u, %u", op.dev, op.row, op.col, op.value & 1);
+        break;
+    case FlushOp::SetCol:
+        printf("%u, %u, 0x%02X", op.dev, op.col, op.value);
+        break;
+    case FlushOp::TogglePixel:
+    case FlushOp::ToggleLed:
+        printf("%u, %u, %u", op.dev, op.row, op.col);
+        break;
+    case FlushOp::WritePixelSpan:
+        printf("%u, %u, %u, len %u, %u", op.dev, op.row, op.col, op.value, op.mask & 1);
+        break;
+    case FlushOp::WriteMasked:
+        printf("%u, %u, 0x%02X, 0x%02X", op.dev, op.col, op.mask, op.value);
+        break;
+    case FlushOp::Invert:
+    case FlushOp::ClearDev:
+    case FlushOp::ShowDev:
+        printf("%u", op.dev);
+        break;
+    case FlushOp::SetBrightness:
+    case FlushOp::SetDecodeMode:
+        printf("%u, 0x%02X", op.dev, op.value);
+        break;
+    case FlushOp::SetShutdown:
+    case FlushOp::TestMode:
+        printf("%u, %u", op.dev, op.value & 1);
+        break;
+    case FlushOp::SetBrightnessAll:
+        printf("{");
+        for (uint8_t i = 0; i < 8; i++)
+            printf(i ? ", %u" : "%u", op.levels[i] & 0x0F);
+        printf("}");
+        break;
+    default:
+        break;
+    }
+    printf(");\n");
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t seeds = 200;
+    uint32_t firstSeed = 1;
+    bool sabotage = false;
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "--seeds") && i + 1 < argc)
+            seeds = strtoul(argv[++i], nullptr, 0);
+        else if (!strcmp(argv[i], "--first") && i + 1 < argc)
+            firstSeed = strtoul(argv[++i], nullptr, 0);
+        else if (!strcmp(argv[i], "--sabotage"))
+            sabotage = true;
+        else
+        {
+            fprintf(stderr, "usage: %s [--seeds N] [--first S] [--sabotage]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    const char *const kindNames[] = {"SBK_MAX72xxHard", "SBK_MAX72xxSoft"};
+    uint64_t totals[variantsNum] = {0};
+    uint32_t runs = 0;
+
+    for (uint8_t k = 0; k < 2; k++)
+    {
+        const FlushDriverKind kind = static_cast<FlushDriverKind>(k);
+        for (uint8_t devsNum = 1; devsNum <= 8; devsNum++)
+        {
+            for (uint32_t seed = firstSeed; seed < firstSeed + seeds; seed++)
+            {
+                rngState = seed * 2654435761u + devsNum * 40503u + k;
+                if (!rngState)
+                    rngState = 1;
+
+                std::vector<FlushOp> ops;
+                for (size_t i = 0; i < opsPerSequence; i++)
+                    ops.push_back(randomOp(devsNum));
+
+                RunResult result = run(ops, kind, devsNum, sabotage);
+                runs++;
+                if (result.ok)
+                {
+                    for (uint8_t v = 0; v < variantsNum; v++)
+                        totals[v] += result.bytes[v];
+                    continue;
+                }
+
+                std::vector<FlushOp> repro = shrink(ops, kind, devsNum, sabotage);
+                RunResult minimal = run(repro, kind, devsNum, sabotage);
+                printf("FAIL %s, %u devices, seed %u: %s differs from reference ", kindNames[k], devsNum,
+                       static_cast<unsigned>(seed), variantNames[minimal.failVariant]);
+                if (minimal.failAt == atBegin)
+                    printf("after begin()\n");
+                else if (minimal.failAt >= repro.size())
+                    printf("after the final show()\n");
+                else
+                    printf("after call %u\n", static_cast<unsigned>(minimal.failAt + 1));
+                printf("Minimal repro (%u of %u calls), after begin():\n", static_cast<unsigned>(repro.size()),
+                       static_cast<unsigned>(ops.size()));
+                for (const FlushOp &op : repro)
+                    printOp(op);
+
+                if (sabotage)
+                {
+                    printf("OK: sabotage caught and shrunk\n");
+                    return 0;
+                }
+                return 1;
+            }
+        }
+    }
+
+    if (sabotage)
+    {
+        printf("FAIL: sabotage not detected in %u runs\n", static_cast<unsigned>(runs));
+        return 1;
+    }
+
+    printf("OK: %u sequences of %u calls, latched state identical after every call\n", static_cast<unsigned>(runs),
+           static_cast<unsigned>(opsPerSequence));
+    for (uint8_t v = 0; v < variantsNum; v++)
+    {
+        printf("  %-10s %10llu bytes", variantNames[v], static_cast<unsigned long long>(totals[v]));
+        if (v && totals[0])
+            printf("  (%.1f%% saved)", 100.0 * (1.0 - static_cast<double>(totals[v]) / totals[0]));
+        printf("\n");
+    }
+    return 0;
+}
@@ -0,0 +1,24 @@
+/**
+ * @file flushVariant.cpp
+ * @brief Factory of one flush variant, built once per variant by the Makefile.
+ *
+ * The build renames the driver classes (e.g. -DSBK_MAX72xxHard=SBK_MAX72xxHardReference)
+ * together with the flags selecting the flush path, and names the factory with
+ * FLUSH_VARIANT_FACTORY, so every variant links into the same harness.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ * @version 2.0.4
+ * @license MIT
+ */
+
+#include "SBK_MAX72xxHard.h"
+#include "SBK_MAX72xxSoft.h"
+#include "FlushSubject.h"
+
+FlushSubject *FLUSH_VARIANT_FACTORY(FlushDriverKind kind, uint8_t csPin, uint8_t devsNum)
+{
+    if (kind == FlushDriverKind::Soft)
+        return new FlushDriver<SBK_MAX72xxSoft>(2, 3, csPin, devsNum); // DIN and CLK pins are unused by the shim
+    return new FlushDriver<SBK_MAX72xxHard>(csPin, devsNum);
+}
@@ -0,0 +1,32 @@
+/**
+ * @file linuxSubject.cpp
+ * @brief SBK_MAX72xxLinux in fake-device mode as a flush equivalence subject.
+ *
+ * The driver shifts its frames through its own SBK_MAX72xxChainSim instead of the shim,
+ * so the harness compares that chain with the reference one. It does not include the
+ * Arduino shim.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ * @version 2.0.4
+ * @license MIT
+ */
+
+#include "SBK_MAX72xxLinux.h"
+#include "FlushSubject.h"
+
+/**
+ * @brief FlushSubject over the fake-device chain of SBK_MAX72xxLinux.
+ */
+class LinuxSubject : public FlushDriver<SBK_MAX72xxLinux>
+{
+public:
+    explicit LinuxSubject(uint8_t devsNum) : FlushDriver<SBK_MAX72xxLinux>(devsNum) {}
+
+    const SBK_MAX72xxChainSim *chain() const override { return _driver.fakeChain(); }
+};
+
+FlushSubject *newLinuxSubject(uint8_t devsNum)
+{
+    return new LinuxSubject(devsNum);
+}
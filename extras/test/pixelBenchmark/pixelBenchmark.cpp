@@ -0,0 +1,101 @@
+/**
+ * @file pixelBenchmark.cpp
+ * @brief Host microbenchmark of the per-pixel cost of setLed() and the unchecked fast API.
+ *
+ * Same loops as examples/pixelBenchmark on the target: the buffer of a 4-device
+ * SBK_MAX72xxHard is filled and cleared with setLed(), setLedFast(), togglePixel() and
+ * writePixelSpan(), and the best of several runs is printed in ns/pixel. Only the buffer is
+ * timed; show() is not called inside the loops. Timings vary with the host, so the
+ * benchmark runs from its own target rather than from check.
+ *
+ * Build and run: make -C extras/test bench
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ * @version 2.0.4
+ * @license MIT
+ */
+
+#include <chrono>
+#include <cstdio>
+#include "Arduino.h"
+#include "ShimBus.h"
+#include "SBK_MAX72xxHard.h"
+
+static constexpr uint8_t devsNum = 4;
+static constexpr uint32_t passes = 20000;
+static constexpr uint32_t pixels = passes * devsNum * 64 * 2; // Set + clear
+static constexpr uint8_t runs = 5;
+
+template <typename Loop>
+static void report(const char *name, Loop loop)
+{
+    double best = 0;
+    for (uint8_t run = 0; run < runs; run++)
+    {
+        auto t0 = std::chrono::steady_clock::now();
+        loop();
+        std::chrono::duration<double, std::nano> ns = std::chrono::steady_clock::now() - t0;
+        if (!run || ns.count() < best)
+            best = ns.count();
+    }
+    printf("%-14s %6.2f ns/pixel\n", name, best / pixels);
+}
+
+int main()
+{
+    SBK_MAX72xxChainSim chain(devsNum);
+    shimAttach(10, &chain);
+    SBK_MAX72xxHard matrix(10, devsNum); // cs pin, num devices
+    matrix.begin();
+
+    report("setLed", [&] {
+        for (uint32_t p = 0; p < passes; p++)
+            for (uint8_t s = 0; s < 2; s++)
+                for (uint8_t d = 0; d < devsNum; d++)
+                    for (uint8_t r = 0; r < 8; r++)
+                        for (uint8_t c = 0; c < 8; c++)
+                            matrix.setLed(d, r, c, s == 0);
+    });
+
+    report("setLedFast", [&] {
+        for (uint32_t p = 0; p < passes; p++)
+            for (uint8_t s = 0; s < 2; s++)
+                for (uint8_t d = 0; d < devsNum; d++)
+                    for (uint8_t r = 0; r < 8; r++)
+                        for (uint8_t c = 0; c < 8; c++)
+                            matrix.setLedFast(d, r, c, s == 0);
+    });
+
+    report("togglePixel", [&] {
+        for (uint32_t p = 0; p < passes; p++)
+            for (uint8_t s = 0; s < 2; s++)
+                for (uint8_t d = 0; d < devsNum; d++)
+                    for (uint8_t r = 0; r < 8; r++)
+                        for (uint8_t c = 0; c < 8; c++)
+                            matrix.togglePixel(d, r, c);
+    });
+
+    report("writePixelSpan", [&] {
+        for (uint32_t p = 0; p < passes; p++)
+            for (uint8_t s = 0; s < 2; s++)
+                for (uint8_t d = 0; d < devsNum; d++)
+                    for (uint8_t r = 0; r < 8; r++)
+                        matrix.writePixelSpan(d, r, 0, 8, s == 0);
+    });
+
+    // The buffer must end up cleared by every loop: keeps the work observable
+    matrix.show();
+    for (uint8_t d = 0; d < devsNum; d++)
+    {
+        for (uint8_t c = 0; c < 8; c++)
+        {
+            if (chain.reg(d, 0x01 + c))
+            {
+                printf("FAIL device %u digit %u not cleared\n", d, c);
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,88 @@
+/**
+ * @file Arduino.h
+ * @brief Minimal Arduino core for building the library's drivers on a host.
+ *
+ * Only what the SBK_MAX72xx sources use. Pin writes and shifted bytes are routed to the
+ * chain simulators attached with shimAttach() (see ShimBus.h): a chain receives the
+ * bytes sent while its CS pin is LOW and latches them when CS goes back HIGH.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ * @version 2.0.4
+ * @license MIT
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define HIGH 1
+#define LOW 0
+#define OUTPUT 1
+#define INPUT 0
+#define MSBFIRST 1
+#define LSBFIRST 0
+#define DEC 10
+#define HEX 16
+
+#define PROGMEM
+#define pgm_read_byte(p) (*(const uint8_t *)(p))
+#define pgm_read_word(p) (*(const uint16_t *)(p))
+#define F(s) s
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+void shiftOut(uint8_t dataPin, uint8_t clockPin, uint8_t bitOrder, uint8_t value);
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+unsigned long micros();
+unsigned long millis();
+
+/**
+ * @brief Print to stdout, enough for SBK_MAX72xxCapture.
+ */
+class Print
+{
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c)
+    {
+        putchar(c);
+        return 1;
+    }
+
+    size_t print(const char *s)
+    {
+        size_t n = 0;
+        while (*s)
+            n += write(*s++);
+        return n;
+    }
+    size_t print(char c) { return write(c); }
+    size_t print(unsigned long value, int base = DEC)
+    {
+        char buf[24];
+        snprintf(buf, sizeof(buf), base == HEX ? "%lX" : "%lu", value);
+        return print(buf);
+    }
+    size_t print(long value)
+    {
+        char buf[24];
+        snprintf(buf, sizeof(buf), "%ld", value);
+        return print(buf);
+    }
+    size_t print(int value, int base = DEC) { return base == DEC ? print(static_cast<long>(value)) : print(static_cast<unsigned long>(value), base); }
+    size_t print(unsigned int value, int base = DEC) { return print(static_cast<unsigned long>(value), base); }
+    size_t print(uint8_t value, int base = DEC) { return print(static_cast<unsigned long>(value), base); }
+
+    size_t println() { return print("\n"); }
+    template <typename T>
+    size_t println(T value) { return print(value) + println(); }
+    template <typename T>
+    size_t println(T value, int base) { return print(value, base) + println(); }
+};
@@ -0,0 +1,41 @@
+/**
+ * @file SPI.h
+ * @brief Minimal Arduino SPI class for building the library's drivers on a host.
+ *
+ * Bytes go to the chain whose CS pin is LOW (see ShimBus.h).
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ * @version 2.0.4
+ * @license MIT
+ */
+
+#pragma once
+
+#include "Arduino.h"
+
+#define SPI_MODE0 0x00
+
+struct SPISettings
+{
+    SPISettings() {}
+    SPISettings(uint32_t clock, uint8_t bitOrder, uint8_t dataMode)
+    {
+        (void)clock;
+        (void)bitOrder;
+        (void)dataMode;
+    }
+};
+
+class SPIClass
+{
+public:
+    void begin() {}
+    void end() {}
+    void beginTransaction(SPISettings settings) { (void)settings; }
+    void endTransaction() {}
+    uint8_t transfer(uint8_t data);
+    void writeBytes(const uint8_t *data, uint32_t size);
+};
+
+extern SPIClass SPI;
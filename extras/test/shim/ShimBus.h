@@ -0,0 +1,31 @@
+/**
+ * @file ShimBus.h
+ * @brief Test hooks of the host Arduino shim: wire a chain simulator behind a CS pin.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ * @version 2.0.4
+ * @license MIT
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "SBK_MAX72xxChainSim.h"
+
+/**
+ * @brief Route the bytes sent while @p csPin is LOW to @p chain (nullptr detaches it).
+ */
+void shimAttach(uint8_t csPin, SBK_MAX72xxChainSim *chain);
+
+/**
+ * @brief Corrupt every byte @p from sent to the chain behind @p csPin into @p to.
+ *
+ * A deliberate wire fault, used to check that a test notices and reports it.
+ */
+void shimSabotage(uint8_t csPin, uint8_t from, uint8_t to);
+
+/**
+ * @brief Detach every chain and drop every sabotage.
+ */
+void shimReset();
@@ -0,0 +1,93 @@
+/**
+ * @file shim.cpp
+ * @brief Host Arduino shim: pins, SPI and shiftOut() feeding SBK_MAX72xxChainSim chains.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ * @version 2.0.4
+ * @license MIT
+ */
+
+#include "Arduino.h"
+#include "SPI.h"
+#include "ShimBus.h"
+
+SPIClass SPI;
+
+struct ShimPin
+{
+    SBK_MAX72xxChainSim *chain;
+    bool low;
+    bool sabotaged;
+    uint8_t from;
+    uint8_t to;
+};
+
+static ShimPin pins[256];
+static unsigned long clockUs = 0;
+
+static void shimShift(uint8_t data)
+{
+    for (ShimPin &pin : pins)
+    {
+        if (pin.chain && pin.low)
+            pin.chain->shift((pin.sabotaged && data == pin.from) ? pin.to : data);
+    }
+}
+
+void shimAttach(uint8_t csPin, SBK_MAX72xxChainSim *chain)
+{
+    pins[csPin].chain = chain;
+    pins[csPin].low = false;
+}
+
+void shimSabotage(uint8_t csPin, uint8_t from, uint8_t to)
+{
+    pins[csPin].sabotaged = true;
+    pins[csPin].from = from;
+    pins[csPin].to = to;
+}
+
+void shimReset()
+{
+    memset(pins, 0, sizeof(pins));
+}
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+    (void)pin;
+    (void)mode;
+}
+
+void digitalWrite(uint8_t pin, uint8_t value)
+{
+    ShimPin &p = pins[pin];
+    if (p.chain && p.low && value == HIGH)
+        p.chain->latch(); // CS rising edge
+    p.low = (value == LOW);
+}
+
+void shiftOut(uint8_t dataPin, uint8_t clockPin, uint8_t bitOrder, uint8_t value)
+{
+    (void)dataPin;
+    (void)clockPin;
+    (void)bitOrder; // The drivers only shift MSB first
+    shimShift(value);
+}
+
+void delay(unsigned long ms) { clockUs += ms * 1000; }
+void delayMicroseconds(unsigned int us) { clockUs += us; }
+unsigned long micros() { return ++clockUs; }
+unsigned long millis() { return clockUs / 1000; }
+
+uint8_t SPIClass::transfer(uint8_t data)
+{
+    shimShift(data);
+    return 0;
+}
+
+void SPIClass::writeBytes(const uint8_t *data, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++)
+        shimShift(data[i]);
+}
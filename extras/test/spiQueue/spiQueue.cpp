@@ -0,0 +1,210 @@
+/**
+ * @file spiQueue.cpp
+ * @brief Host test of SBK_MAX72xxSpiQueue, the in-flight bookkeeping of SBK_MAX72xxEsp32.
+ *
+ * A mock transport stands in for the ESP-IDF SPI master: like DMA, it reads a queued
+ * frame through its descriptor only when the frame completes, and it reports any
+ * descriptor handed out again while it still owns it. Completed frames are clocked into a
+ * SBK_MAX72xxChainSim, which must end up exactly as if every frame had been sent in order.
+ *
+ * Build and run: make -C extras/test check
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ * @version 2.0.4
+ * @license MIT
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <vector>
+#include "SBK_MAX72xxChainSim.h"
+#include "SBK_MAX72xxSpiQueue.h"
+
+static constexpr uint8_t devsNum = 4;
+static constexpr uint8_t frameBytes = devsNum * 2;
+static constexpr uint8_t slots = 8;
+
+static int failures = 0;
+
+static void check(bool ok, const char *what)
+{
+    if (!ok && failures++ < 10)
+        printf("FAIL %s\n", what);
+}
+
+/**
+ * @brief Transport double: IDF-like queue with completion under test control.
+ */
+class MockTransport
+{
+public:
+    struct Descriptor
+    {
+        const uint8_t *data;
+        uint16_t len;
+    };
+
+    explicit MockTransport(SBK_MAX72xxChainSim &chain) : _chain(chain) {}
+
+    bool queue(Descriptor &d, const uint8_t *data, uint16_t len)
+    {
+        for (Descriptor *owned : _queued)
+            check(owned != &d, "descriptor queued again while the transport owns it");
+        for (Descriptor *owned : _done)
+            check(owned != &d, "descriptor queued again before its result was collected");
+        check(_queued.size() + _done.size() < slots, "more frames in flight than the device queue holds");
+
+        d.data = data;
+        d.len = len;
+        _queued.push_back(&d);
+        return true;
+    }
+
+    Descriptor *result(bool wait)
+    {
+        if (_done.empty() && wait && !_queued.empty())
+            complete(1); // Blocking: the hardware finishes the oldest frame
+        if (_done.empty())
+            return nullptr;
+
+        Descriptor *d = _done.front();
+        _done.pop_front();
+        return d;
+    }
+
+    void transmit(const uint8_t *data, uint16_t len)
+    {
+        check(_queued.empty() && _done.empty(), "transmit() while frames are still queued");
+        _chain.frame(data, len);
+    }
+
+    /**
+     * @brief The hardware finishes up to @p n queued frames; DMA reads them only now.
+     */
+    void complete(size_t n)
+    {
+        for (; n && !_queued.empty(); n--)
+        {
+            Descriptor *d = _queued.front();
+            _queued.pop_front();
+            _chain.frame(d->data, d->len);
+            _done.push_back(d);
+        }
+    }
+
+    size_t owned() const { return _queued.size() + _done.size(); }
+
+private:
+    SBK_MAX72xxChainSim &_chain;
+    std::deque<Descriptor *> _queued; // Being sent, in order
+    std::deque<Descriptor *> _done;   // Sent, result not collected yet
+};
+
+typedef SBK_MAX72xxSpiQueue<MockTransport, slots> Queue;
+
+// Every frame stays alive until the end, like the driver's frame buffers (moving the
+// outer vector keeps each frame's bytes in place)
+static std::vector<std::vector<uint8_t>> frames;
+static uint32_t rngState = 0x9E3779B9;
+
+static uint32_t nextRandom()
+{
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 17;
+    rngState ^= rngState << 5;
+    return rngState;
+}
+
+static const uint8_t *newFrame(SBK_MAX72xxChainSim &expected)
+{
+    std::vector<uint8_t> frame(frameBytes);
+    for (uint8_t k = 0; k < devsNum; k++)
+    {
+        frame[2 * k] = (nextRandom() % 4) ? 1 + nextRandom() % 8 : 0x00;
+        frame[2 * k + 1] = nextRandom();
+    }
+    frames.push_back(frame);
+    expected.frame(frames.back().data(), frameBytes);
+    return frames.back().data();
+}
+
+static void descriptorsReusedOnlyAfterReturn()
+{
+    // show() queues 8 frames, busy() collects 3, the next show() queues more
+    SBK_MAX72xxChainSim chain(devsNum), expected(devsNum);
+    MockTransport transport(chain);
+    Queue queue(transport);
+    frames.clear();
+
+    for (uint8_t i = 0; i < 8; i++)
+        queue.queue(newFrame(expected), frameBytes);
+    check(queue.inFlight() == 8, "8 frames in flight after a full refresh");
+
+    transport.complete(3);
+    check(queue.busy(), "busy() while 5 frames are still queued");
+    check(queue.inFlight() == 5, "busy() collects exactly the 3 finished frames");
+
+    for (uint8_t i = 0; i < 4; i++)
+        queue.queue(newFrame(expected), frameBytes); // The 4th one must wait for the oldest
+    check(queue.inFlight() == transport.owned(), "in-flight count matches the transport");
+
+    queue.waitIdle();
+    check(queue.inFlight() == 0 && transport.owned() == 0, "waitIdle() collects everything");
+    check(chain.frames() == expected.frames() && chain.sameRegisters(expected), "latched state after show(), busy(), show()");
+}
+
+static void randomScenario()
+{
+    SBK_MAX72xxChainSim chain(devsNum), expected(devsNum);
+    MockTransport transport(chain);
+    Queue queue(transport);
+    frames.clear();
+
+    for (uint32_t step = 0; step < 30000; step++)
+    {
+        switch (nextRandom() % 8)
+        {
+        case 0:
+        case 1:
+        case 2:
+            queue.queue(newFrame(expected), frameBytes); // show()
+            break;
+        case 3:
+        case 4:
+            transport.complete(nextRandom() % 4); // Hardware progress
+            break;
+        case 5:
+            queue.busy();
+            break;
+        case 6:
+            if (nextRandom() % 4 == 0)
+                queue.waitIdle();
+            break;
+        default:
+            if (nextRandom() % 4 == 0)
+                queue.transmit(newFrame(expected), frameBytes); // Register write
+            break;
+        }
+        check(queue.inFlight() == transport.owned(), "in-flight count matches the frames the transport owns");
+    }
+
+    queue.waitIdle();
+    check(chain.frames() == expected.frames(), "every frame sent exactly once");
+    check(chain.sameRegisters(expected), "latched state after random show/busy/waitIdle/transmit");
+}
+
+int main()
+{
+    descriptorsReusedOnlyAfterReturn();
+    randomScenario();
+
+    if (failures)
+    {
+        printf("%d failures\n", failures);
+        return 1;
+    }
+    printf("OK: descriptors reused only once returned, frames latched in order\n");
+    return 0;
+}
@@ -0,0 +1,67 @@
+/**
+ * @file SBK_MAX72xxAsset.h
+ * @brief Decoder for compressed column-byte assets produced by extras/assetCompiler.
+ *
+ * Part of the SBK_MAX72xx Arduino Library.
+ * Uncompressed assets need no decoding at all: they are already column bytes in the
+ * driver's orientation. Compressed ones use a byte-oriented run-length code, optionally on
+ * the XOR of consecutive animation frames (delta), so that unchanged areas of an animation
+ * cost two bytes per run:
+ *
+ *   control 0–127   : copy the next control + 1 bytes
+ *   control 128–255 : repeat the next byte control - 126 times (2–129)
+ *
+ * Each frame is encoded on its own, so frames can be unpacked one after the other.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ *
+ * @version 2.0.4
+ *
+ * @license MIT
+ *
+ * @copyright
+ * Copyright (c) 2025 Samuel Barabé
+ *
+ * Repository: https://github.com/sbarabe/SBK_MAX72xx
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "SBK_MAX72xxFast.h"
+
+/**
+ * @brief Unpack one run-length encoded frame.
+ *
+ * @param src     Encoded data.
+ * @param dst     Frame buffer of @p len bytes.
+ * @param len     Decoded frame size in bytes (width × bands).
+ * @param xorInto true for delta frames: XOR into the previous frame already in @p dst.
+ * @param inFlash true if @p src is declared PROGMEM (default).
+ * @return Start of the next encoded frame.
+ */
+static inline const uint8_t *SBK_MAX72xxUnpack(const uint8_t *src, uint8_t *dst, uint16_t len, bool xorInto = false,
+                                               bool inFlash = true)
+{
+    uint16_t i = 0;
+    while (i < len)
+    {
+        uint8_t control = inFlash ? SBK_MAX72xxReadFlash(src) : *src;
+        src++;
+
+        bool run = control >= 128;
+        uint8_t count = run ? control - 126 : control + 1;
+        uint8_t value = 0;
+        for (uint8_t k = 0; k < count && i < len; k++, i++)
+        {
+            if (!run || k == 0)
+            {
+                value = inFlash ? SBK_MAX72xxReadFlash(src) : *src;
+                src++;
+            }
+            dst[i] = xorInto ? dst[i] ^ value : value;
+        }
+    }
+    return src;
+}
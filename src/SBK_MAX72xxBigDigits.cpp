@@ -0,0 +1,81 @@
+/**
+ * @file SBK_MAX72xxBigDigits.cpp
+ * @brief Built-in big digit fonts (3x8, 5x8 and 10x16) for SBK_MAX72xxBigNumber.
+ *
+ * Part of the SBK_MAX72xx Arduino Library.
+ *
+ * Digits '0'–'9' then '-', column bytes band by band, row 0 = MSB like the driver
+ * buffers. The 10x16 font is the 5x8 one with every pixel doubled. Stored in flash (PROGMEM).
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ *
+ * @version 2.0.4
+ *
+ * @license MIT
+ *
+ * Copyright (c) 2025 Samuel Barabé
+ */
+
+#include "SBK_MAX72xxBigDigits.h"
+
+static const uint8_t digits3x8Columns[] PROGMEM = {
+    0xFF, 0x81, 0xFF, // 0
+    0x41, 0xFF, 0x01, // 1
+    0x9F, 0x91, 0xF1, // 2
+    0x91, 0x91, 0xFF, // 3
+    0xF0, 0x10, 0xFF, // 4
+    0xF1, 0x91, 0x9F, // 5
+    0xFF, 0x91, 0x9F, // 6
+    0x80, 0x8F, 0xF0, // 7
+    0xFF, 0x91, 0xFF, // 8
+    0xF9, 0x89, 0xFF, // 9
+    0x10, 0x10, 0x10, // -
+};
+
+static const uint8_t digits5x8Columns[] PROGMEM = {
+    0x7E, 0xFF, 0x81, 0xFF, 0x7E, // 0
+    0x00, 0x41, 0xFF, 0xFF, 0x01, // 1
+    0x47, 0xCF, 0x99, 0xF1, 0x61, // 2
+    0x42, 0xC3, 0x91, 0xFF, 0x6E, // 3
+    0x18, 0x38, 0x48, 0xFF, 0xFF, // 4
+    0xF2, 0xF3, 0x91, 0x9F, 0x8E, // 5
+    0x7E, 0xFF, 0x91, 0x9F, 0x0E, // 6
+    0x80, 0x87, 0x9F, 0xF8, 0xE0, // 7
+    0x6E, 0xFF, 0x91, 0xFF, 0x6E, // 8
+    0x70, 0xF9, 0x89, 0xFF, 0x7E, // 9
+    0x18, 0x18, 0x18, 0x18, 0x18, // -
+};
+
+static const uint8_t digits10x16Columns[] PROGMEM = {
+    0x3F, 0x3F, 0xFF, 0xFF, 0xC0, 0xC0, 0xFF, 0xFF, 0x3F, 0x3F, // 0 (top band)
+    0xFC, 0xFC, 0xFF, 0xFF, 0x03, 0x03, 0xFF, 0xFF, 0xFC, 0xFC, // 0 (bottom band)
+    0x00, 0x00, 0x30, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, // 1 (top band)
+    0x00, 0x00, 0x03, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x03, // 1 (bottom band)
+    0x30, 0x30, 0xF0, 0xF0, 0xC3, 0xC3, 0xFF, 0xFF, 0x3C, 0x3C, // 2 (top band)
+    0x3F, 0x3F, 0xFF, 0xFF, 0xC3, 0xC3, 0x03, 0x03, 0x03, 0x03, // 2 (bottom band)
+    0x30, 0x30, 0xF0, 0xF0, 0xC3, 0xC3, 0xFF, 0xFF, 0x3C, 0x3C, // 3 (top band)
+    0x0C, 0x0C, 0x0F, 0x0F, 0x03, 0x03, 0xFF, 0xFF, 0xFC, 0xFC, // 3 (bottom band)
+    0x03, 0x03, 0x0F, 0x0F, 0x30, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, // 4 (top band)
+    0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, // 4 (bottom band)
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xC3, 0xC3, 0xC3, 0xC0, 0xC0, // 5 (top band)
+    0x0C, 0x0C, 0x0F, 0x0F, 0x03, 0x03, 0xFF, 0xFF, 0xFC, 0xFC, // 5 (bottom band)
+    0x3F, 0x3F, 0xFF, 0xFF, 0xC3, 0xC3, 0xC3, 0xC3, 0x00, 0x00, // 6 (top band)
+    0xFC, 0xFC, 0xFF, 0xFF, 0x03, 0x03, 0xFF, 0xFF, 0xFC, 0xFC, // 6 (bottom band)
+    0xC0, 0xC0, 0xC0, 0xC0, 0xC3, 0xC3, 0xFF, 0xFF, 0xFC, 0xFC, // 7 (top band)
+    0x00, 0x00, 0x3F, 0x3F, 0xFF, 0xFF, 0xC0, 0xC0, 0x00, 0x00, // 7 (bottom band)
+    0x3C, 0x3C, 0xFF, 0xFF, 0xC3, 0xC3, 0xFF, 0xFF, 0x3C, 0x3C, // 8 (top band)
+    0xFC, 0xFC, 0xFF, 0xFF, 0x03, 0x03, 0xFF, 0xFF, 0xFC, 0xFC, // 8 (bottom band)
+    0x3F, 0x3F, 0xFF, 0xFF, 0xC0, 0xC0, 0xFF, 0xFF, 0x3F, 0x3F, // 9 (top band)
+    0x00, 0x00, 0xC3, 0xC3, 0xC3, 0xC3, 0xFF, 0xFF, 0xFC, 0xFC, // 9 (bottom band)
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, // - (top band)
+    0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, // - (bottom band)
+};
+
+static const uint8_t colon1x8Columns[] PROGMEM = {0x66};
+static const uint8_t colon2x8Columns[] PROGMEM = {0x66, 0x66};
+static const uint8_t colon4x16Columns[] PROGMEM = {0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C};
+
+const SBK_MAX72xxBigFont SBK_MAX72xxDigits3x8 = {digits3x8Columns, colon1x8Columns, 3, 1, 1, 1};
+const SBK_MAX72xxBigFont SBK_MAX72xxDigits5x8 = {digits5x8Columns, colon2x8Columns, 5, 2, 1, 1};
+const SBK_MAX72xxBigFont SBK_MAX72xxDigits10x16 = {digits10x16Columns, colon4x16Columns, 10, 4, 2, 2};
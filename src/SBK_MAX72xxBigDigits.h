@@ -0,0 +1,301 @@
+/**
+ * @file SBK_MAX72xxBigDigits.h
+ * @brief Large clock and number digits spanning several panels, redrawn digit by digit.
+ *
+ * Part of the SBK_MAX72xx Arduino Library.
+ * A display is a row of slots (digits and colons) laid out once from a format string such
+ * as "88:88:88". Each slot remembers the glyph it currently shows; an update only
+ * rasterizes the slots whose glyph changed, and within them only the columns whose byte
+ * differs from the old glyph. The columns written form the dirty set, so an HH:MM:SS
+ * clock touches the seconds columns on most ticks instead of the whole strip.
+ * Fonts taller than 8 rows use several bands, each band on its own row of panels.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ *
+ * @version 2.0.4
+ *
+ * @license MIT
+ *
+ * @copyright
+ * Copyright (c) 2025 Samuel Barabé
+ *
+ * Repository: https://github.com/sbarabe/SBK_MAX72xx
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+#include "SBK_MAX72xxFast.h"
+
+/**
+ * @struct SBK_MAX72xxBigFont
+ * @brief Digits '0'–'9' and '-' as column bytes, one or more 8-row bands high.
+ *
+ * Glyphs are back to back in flash, each stored band by band (top band first), @p width
+ * column bytes per band, row 0 = MSB.
+ */
+struct SBK_MAX72xxBigFont
+{
+    const uint8_t *columns; ///< 11 glyphs ('0'–'9', '-') in flash (PROGMEM)
+    const uint8_t *colon;   ///< Colon glyph in flash (PROGMEM), band by band
+    uint8_t width;          ///< Columns per digit
+    uint8_t colonWidth;     ///< Columns of the colon
+    uint8_t bands;          ///< Height in 8-row bands
+    uint8_t spacing;        ///< Blank columns between two slots
+};
+
+/// 3x8 digits: "88:88:88" fits 32 columns (4 panels).
+extern const SBK_MAX72xxBigFont SBK_MAX72xxDigits3x8;
+
+/// 5x8 bold digits: "88:88" fits 32 columns (4 panels).
+extern const SBK_MAX72xxBigFont SBK_MAX72xxDigits5x8;
+
+/// 10x16 bold digits on two rows of panels: "88:88" fits 64 columns per row.
+extern const SBK_MAX72xxBigFont SBK_MAX72xxDigits10x16;
+
+/**
+ * @class SBK_MAX72xxBigNumber
+ * @brief Clock or number display in big digits with per-slot glyph caching.
+ *
+ * @tparam Driver   Any SBK_MAX72xx driver class (SBK_MAX72xxHard, SBK_MAX72xxSoft, ...).
+ * @tparam MaxSlots Maximum number of slots (digits and colons) in the format.
+ *
+ * Columns are chain-wide (x = devIdx × 8 + colIdx). Band b of the font starts at chain
+ * column x + b × bandStride, e.g. the second row of panels of a 2 × 4 arrangement.
+ */
+template <typename Driver, uint8_t MaxSlots = 8>
+class SBK_MAX72xxBigNumber
+{
+public:
+    /**
+     * @param driver     Driver to draw into.
+     * @param font       Digit font (not copied).
+     * @param format     '8' (or '0') for a digit slot, ':' for a colon slot; other characters are ignored.
+     * @param x          Chain-wide column of the first slot.
+     * @param bandStride Chain columns between two bands; 0 splits the chain evenly between the bands.
+     */
+    SBK_MAX72xxBigNumber(Driver &driver, const SBK_MAX72xxBigFont &font, const char *format = "88:88",
+                         uint16_t x = 0, uint16_t bandStride = 0)
+        : _driver(driver),
+          _font(font),
+          _x(x),
+          _bandStride(bandStride ? bandStride : driver.devsNum() * driver.maxColumns() / (font.bands ? font.bands : 1))
+    {
+        for (; format && *format && _slotsNum < MaxSlots; format++)
+        {
+            bool colon = *format == ':';
+            if (!colon && *format != '8' && *format != '0')
+                continue;
+
+            // Each slot owns its trailing gap, so a first draw also blanks the gaps
+            if (_slotsNum)
+                _slotWidth[_slotsNum - 1] += _font.spacing;
+            _colon[_slotsNum] = colon;
+            _start[_slotsNum] = _width;
+            _slotWidth[_slotsNum] = colon ? _font.colonWidth : _font.width;
+            _width = _start[_slotsNum] + _font.spacing + _slotWidth[_slotsNum];
+            _want[_slotsNum] = colon ? 0 : _blank;
+            _slotsNum++;
+        }
+        if (_slotsNum)
+            _width -= _font.spacing;
+
+        _dirty = new uint8_t[(_width + 7) / 8]();
+        invalidate();
+    }
+
+    ~SBK_MAX72xxBigNumber()
+    {
+        // Release the dynamically allocated memory
+        delete[] _dirty;
+    }
+
+    /**
+     * @brief Width of the display in columns (one band).
+     */
+    uint16_t width() const { return _width; }
+
+    /**
+     * @brief Show text in the digit slots, left to right: '0'–'9', '-', anything else is blank.
+     *
+     * Colons in @p text are skipped, so "12:34" and "1234" are the same.
+     */
+    void setDigits(const char *text)
+    {
+        for (uint8_t s = 0; s < _slotsNum; s++)
+        {
+            if (_colon[s])
+                continue;
+            while (text && *text == ':')
+                text++;
+            char c = (text && *text) ? *text++ : ' ';
+            _want[s] = (c >= '0' && c <= '9') ? c - '0' : (c == '-') ? _minus : _blank;
+        }
+    }
+
+    /**
+     * @brief Show an integer right-aligned in the digit slots.
+     *
+     * Leading zeros are blank unless @p leadingZeros. A value that does not fit shows dashes.
+     */
+    void setNumber(int32_t value, bool leadingZeros = false)
+    {
+        uint8_t digits = 0;
+        for (uint8_t s = 0; s < _slotsNum; s++)
+            digits += !_colon[s];
+
+        char text[MaxSlots + 1];
+        memset(text, leadingZeros ? '0' : ' ', digits);
+        text[digits] = '\0';
+
+        bool negative = value < 0;
+        uint32_t magnitude = negative ? 0 - static_cast<uint32_t>(value) : static_cast<uint32_t>(value);
+        int8_t i = digits - 1;
+        do
+        {
+            if (i < 0)
+                break;
+            text[i--] = '0' + magnitude % 10;
+            magnitude /= 10;
+        } while (magnitude);
+
+        if (negative && i >= 0)
+            text[leadingZeros ? 0 : i] = '-';
+        if (magnitude || (negative && i < 0))
+            memset(text, '-', digits); // Overflow
+
+        setDigits(text);
+    }
+
+    /**
+     * @brief Show a time, two digit slots per field (HH, MM, then SS if the format has room).
+     *
+     * @param leadingZero false blanks the first hour digit below 10 ("9:05" instead of "09:05").
+     */
+    void setTime(uint8_t hours, uint8_t minutes, uint8_t seconds = 0, bool leadingZero = true)
+    {
+        const char text[7] = {
+            static_cast<char>((hours < 10 && !leadingZero) ? ' ' : '0' + hours / 10 % 10),
+            static_cast<char>('0' + hours % 10),
+            static_cast<char>('0' + minutes / 10 % 10), static_cast<char>('0' + minutes % 10),
+            static_cast<char>('0' + seconds / 10 % 10), static_cast<char>('0' + seconds % 10), '\0'};
+        setDigits(text);
+    }
+
+    /**
+     * @brief Show or hide the colons (call every half second to blink them).
+     */
+    void setColon(bool visible)
+    {
+        for (uint8_t s = 0; s < _slotsNum; s++)
+            if (_colon[s])
+                _want[s] = visible ? 0 : _blank;
+    }
+
+    /**
+     * @brief Forget what is displayed, so the next flush() redraws every slot (e.g. after clear()).
+     */
+    void invalidate()
+    {
+        memset(_shown, _unknown, sizeof(_shown));
+    }
+
+    /**
+     * @brief Write the columns of the slots that changed into the driver buffer (no SPI traffic).
+     *
+     * @return Number of columns written, the size of the dirty set.
+     */
+    uint16_t flush()
+    {
+        memset(_dirty, 0, (_width + 7) / 8);
+        uint16_t written = 0;
+
+        for (uint8_t s = 0; s < _slotsNum; s++)
+        {
+            if (_want[s] == _shown[s])
+                continue; // Cached: same glyph as displayed
+
+            for (uint8_t c = 0; c < _slotWidth[s]; c++)
+            {
+                bool dirty = false;
+                for (uint8_t b = 0; b < _font.bands; b++)
+                {
+                    uint8_t value = _glyphCol(s, _want[s], b, c);
+                    if (_shown[s] != _unknown && value == _glyphCol(s, _shown[s], b, c))
+                        continue;
+
+                    _put(_x + b * _bandStride + _start[s] + c, value);
+                    dirty = true;
+                }
+
+                if (dirty)
+                {
+                    uint16_t x = _start[s] + c;
+                    _dirty[x / 8] |= 1 << (x % 8);
+                    written++;
+                }
+            }
+            _shown[s] = _want[s];
+        }
+        return written;
+    }
+
+    /**
+     * @brief flush() then show() on the driver.
+     *
+     * @return Number of columns written.
+     */
+    uint16_t show()
+    {
+        uint16_t written = flush();
+        _driver.show();
+        return written;
+    }
+
+    /**
+     * @brief true if column @p x of the display (0 = first slot) was written by the last flush().
+     */
+    bool columnDirty(uint16_t x) const
+    {
+        return x < _width && (_dirty[x / 8] & (1 << (x % 8)));
+    }
+
+private:
+    static constexpr uint8_t _minus = 10; // Glyph index of '-'
+    static constexpr uint8_t _blank = 0xFE; // Empty slot
+    static constexpr uint8_t _unknown = 0xFF; // Slot content unknown: redraw every column
+
+    uint8_t _glyphCol(uint8_t slot, uint8_t glyph, uint8_t band, uint8_t col) const
+    {
+        if (glyph == _blank)
+            return 0;
+        if (_colon[slot])
+            return col < _font.colonWidth ? SBK_MAX72xxReadFlash(_font.colon + band * _font.colonWidth + col) : 0;
+        return col < _font.width
+                   ? SBK_MAX72xxReadFlash(_font.columns + (glyph * _font.bands + band) * _font.width + col)
+                   : 0;
+    }
+
+    void _put(uint16_t x, uint8_t value)
+    {
+        const uint8_t devCols = _driver.maxColumns();
+        if (x < _driver.devsNum() * devCols)
+            _driver.setCol(x / devCols, x % devCols, value);
+    }
+
+    Driver &_driver;
+    const SBK_MAX72xxBigFont &_font;
+    const uint16_t _x;
+    const uint16_t _bandStride;
+    uint16_t _width = 0;
+    uint8_t _slotsNum = 0;
+    uint8_t *_dirty = nullptr; // Columns written by the last flush(), 1 bit each
+
+    bool _colon[MaxSlots] = {false}; // Slot is a colon
+    uint16_t _start[MaxSlots] = {0}; // First column of each slot
+    uint8_t _slotWidth[MaxSlots] = {0}; // Columns owned by each slot, trailing gap included
+    uint8_t _want[MaxSlots] = {0}; // Glyph to display
+    uint8_t _shown[MaxSlots] = {0}; // Glyph displayed (the cache)
+};
@@ -0,0 +1,150 @@
+/**
+ * @file SBK_MAX72xxBitmap.h
+ * @brief Compile-time conversion of ASCII-art bitmaps into column bytes.
+ *
+ * Part of the SBK_MAX72xx Arduino Library.
+ * SBK_MAX72xxArt() is constexpr: the art string is read by the compiler, and only the
+ * resulting column bytes (row 0 = MSB, as setCol() expects) end up in the program. Declared
+ * PROGMEM, a bitmap stays in flash. Works with C++11 (the AVR toolchains' default).
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ *
+ * @version 2.0.4
+ *
+ * @license MIT
+ *
+ * @copyright
+ * Copyright (c) 2025 Samuel Barabé
+ *
+ * Repository: https://github.com/sbarabe/SBK_MAX72xx
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * @struct SBK_MAX72xxBitmap
+ * @brief Fixed-width 8-row bitmap as column bytes.
+ *
+ * @tparam Width Number of columns.
+ */
+template <uint16_t Width>
+struct SBK_MAX72xxBitmap
+{
+    uint8_t cols[Width]; ///< Column bytes, row 0 = MSB
+
+    static constexpr uint16_t width() { return Width; }
+    constexpr uint8_t operator[](uint16_t x) const { return cols[x]; }
+};
+
+namespace SBK_MAX72xxDetail
+{
+    template <uint16_t... Is>
+    struct IndexList
+    {
+    };
+
+    template <uint16_t N, uint16_t... Is>
+    struct MakeIndices : MakeIndices<N - 1, N - 1, Is...>
+    {
+    };
+
+    template <uint16_t... Is>
+    struct MakeIndices<0, Is...>
+    {
+        typedef IndexList<Is...> type;
+    };
+
+    constexpr bool artLit(char c)
+    {
+        return c != '.' && c != ' ' && c != '_' && c != '0';
+    }
+
+    constexpr uint8_t artCol(const char *art, uint16_t width, uint16_t x, uint8_t row = 0)
+    {
+        return row == 8 ? 0 : static_cast<uint8_t>((artLit(art[row * width + x]) ? (0x80 >> row) : 0) | artCol(art, width, x, row + 1));
+    }
+
+    template <uint16_t Width, uint16_t... Is>
+    constexpr SBK_MAX72xxBitmap<Width> artBitmap(const char *art, IndexList<Is...>)
+    {
+        return SBK_MAX72xxBitmap<Width>{{artCol(art, Width, Is)...}};
+    }
+}
+
+/**
+ * @brief Convert an 8-row ASCII-art string into column bytes at compile time.
+ *
+ * The string is the 8 rows back to back, top row first; concatenated literals keep it
+ * readable. '.', ' ', '_' and '0' are unlit, any other character is lit. The width is
+ * the string length / 8. Example:
+ *
+ *   static const SBK_MAX72xxBitmap<8> heart PROGMEM = SBK_MAX72xxArt(
+ *       ".XX..XX."
+ *       "XXXXXXXX"
+ *       "XXXXXXXX"
+ *       "XXXXXXXX"
+ *       ".XXXXXX."
+ *       "..XXXX.."
+ *       "...XX..."
+ *       "........");
+ *
+ * Wider art (e.g. 16 columns) gives several 8-column frames back to back, as used by
+ * SBK_MAX72xxIcon.
+ */
+template <size_t N>
+constexpr SBK_MAX72xxBitmap<(N - 1) / 8> SBK_MAX72xxArt(const char (&art)[N])
+{
+    static_assert(N > 1 && (N - 1) % 8 == 0, "SBK_MAX72xxArt: the art must be 8 rows of equal width");
+    return SBK_MAX72xxDetail::artBitmap<(N - 1) / 8>(art, typename SBK_MAX72xxDetail::MakeIndices<(N - 1) / 8>::type());
+}
+
+// Compile-time checks of the conversion (no code or data generated)
+static_assert(SBK_MAX72xxArt("X......."
+                             "........"
+                             "........"
+                             "........"
+                             "........"
+                             "........"
+                             "........"
+                             ".......X")[0] == 0x80,
+              "SBK_MAX72xxArt: row 0 must be the MSB");
+static_assert(SBK_MAX72xxArt("X......."
+                             "........"
+                             "........"
+                             "........"
+                             "........"
+                             "........"
+                             "........"
+                             ".......X")[7] == 0x01,
+              "SBK_MAX72xxArt: row 7 must be the LSB of the last column");
+static_assert(SBK_MAX72xxArt("#..#"
+                             "#..#"
+                             "#..#"
+                             "#..#"
+                             "#..#"
+                             "#..#"
+                             "#..#"
+                             "####")[1] == 0x01 &&
+                  SBK_MAX72xxArt("#..#"
+                                 "#..#"
+                                 "#..#"
+                                 "#..#"
+                                 "#..#"
+                                 "#..#"
+                                 "#..#"
+                                 "####")[3] == 0xFF,
+              "SBK_MAX72xxArt: columns must follow the art from left to right");
+static_assert(SBK_MAX72xxArt("____0000"
+                             "        "
+                             "........"
+                             "........"
+                             "........"
+                             "........"
+                             "........"
+                             "........")
+                      .width() == 8,
+              "SBK_MAX72xxArt: width must be the string length / 8");
@@ -0,0 +1,124 @@
+/**
+ * @file SBK_MAX72xxBitstream.h
+ * @brief Portable encoder turning several MAX72xx chain frames into one parallel bitstream.
+ *
+ * Part of the SBK_MAX72xx Arduino Library.
+ * Used by SBK_MAX72xxParallel to drive up to 16 chains from a single parallel bus:
+ * every output word carries one DIN bit for each chain, and the bus write strobe acts as
+ * the shared CLK. The encoder has no hardware dependency so it can be checked on any host.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ *
+ * @version 2.0.4
+ *
+ * @license MIT
+ *
+ * @copyright
+ * Copyright (c) 2025 Samuel Barabé
+ *
+ * Repository: https://github.com/sbarabe/SBK_MAX72xx
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * @class SBK_MAX72xxBitstream
+ * @brief Bit-interleaves chain frames into parallel bus words (bit c = chain c's DIN).
+ */
+class SBK_MAX72xxBitstream
+{
+public:
+    /// Maximum number of chains, one per data line of a 16-bit bus.
+    static constexpr uint8_t maxChains = 16;
+
+    /**
+     * @brief Number of bus words needed for one frame of @p frameBytes bytes.
+     */
+    static constexpr uint16_t wordsPerFrame(uint8_t frameBytes) { return frameBytes * 8; }
+
+    /**
+     * @brief Data lines needed on the bus for @p chainsNum chains: 8 up to 8 chains, 16 above.
+     */
+    static constexpr uint8_t busWidth(uint8_t chainsNum) { return chainsNum > 8 ? 16 : 8; }
+
+    /**
+     * @brief Encode one frame per chain into parallel words.
+     *
+     * @param frames     @p chainsNum frames of @p frameBytes bytes each, stored back to back
+     *                   (chain 0 first). Bytes are in wire order, as a single chain would send them.
+     * @param chainsNum  Number of chains (1 to maxChains). Unused data lines stay LOW.
+     * @param frameBytes Bytes per frame (2 × devices per chain).
+     * @param out        Destination, wordsPerFrame(frameBytes) words. Word k holds bit
+     *                   (7 - k % 8) of byte k / 8 of every chain, MSB first like SPI mode 0.
+     */
+    static void encode(const uint8_t *frames, uint8_t chainsNum, uint8_t frameBytes, uint16_t *out)
+    {
+        if (chainsNum > maxChains)
+            chainsNum = maxChains;
+
+        for (uint8_t byteIdx = 0; byteIdx < frameBytes; byteIdx++)
+        {
+            // Spread each chain's byte onto 8 words at once: bit b of the byte lands in
+            // word (7 - b), at bit position c of that word
+            uint16_t words[8] = {0};
+            const uint8_t *src = frames + byteIdx;
+
+            for (uint8_t c = 0; c < chainsNum; c++, src += frameBytes)
+            {
+                uint8_t value = *src;
+                if (!value)
+                    continue; // NOOP and blank columns are common
+
+                uint16_t chainBit = static_cast<uint16_t>(1u << c);
+                for (uint8_t bit = 0; bit < 8; bit++)
+                {
+                    if (value & (0x80 >> bit))
+                        words[bit] |= chainBit;
+                }
+            }
+
+            for (uint8_t bit = 0; bit < 8; bit++)
+                *out++ = words[bit];
+        }
+    }
+
+    /**
+     * @brief Store encoded words the way the bus DMA reads them.
+     *
+     * @param words    Encoded words.
+     * @param wordsNum Number of words.
+     * @param busWidth 8: one byte per word (chains 0–7), 16: two bytes per word, low byte first.
+     * @param out      Destination, @p wordsNum × @p busWidth / 8 bytes.
+     */
+    static void pack(const uint16_t *words, uint16_t wordsNum, uint8_t busWidth, uint8_t *out)
+    {
+        for (uint16_t k = 0; k < wordsNum; k++)
+        {
+            *out++ = static_cast<uint8_t>(words[k]);
+            if (busWidth == 16)
+                *out++ = static_cast<uint8_t>(words[k] >> 8);
+        }
+    }
+
+    /**
+     * @brief Recover one chain's frame from encoded words (inverse of encode()).
+     *
+     * @param words      Encoded words, wordsPerFrame(frameBytes) of them.
+     * @param chainIdx   Chain (data line) to extract.
+     * @param frameBytes Bytes per frame.
+     * @param out        Destination, @p frameBytes bytes in wire order.
+     */
+    static void decode(const uint16_t *words, uint8_t chainIdx, uint8_t frameBytes, uint8_t *out)
+    {
+        for (uint8_t byteIdx = 0; byteIdx < frameBytes; byteIdx++)
+        {
+            uint8_t value = 0;
+            for (uint8_t bit = 0; bit < 8; bit++)
+                value = (value << 1) | ((*words++ >> chainIdx) & 0x01);
+            out[byteIdx] = value;
+        }
+    }
+};
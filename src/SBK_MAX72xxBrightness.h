@@ -0,0 +1,210 @@
+/**
+ * @file SBK_MAX72xxBrightness.h
+ * @brief Perceptual brightness (0–255) with per-device calibration over the 16 intensity steps.
+ *
+ * Part of the SBK_MAX72xx Arduino Library.
+ * A logical level plus the device's calibration offset goes through a gamma 2.2 table to a
+ * 4.4 fixed-point intensity (whole steps 0–15, sixteenths in between). Without dithering
+ * the value is rounded to the nearest step; with dithering each tick() picks the lower or
+ * upper step in a bit-angle order, so a device spends the right fraction of ticks on each.
+ * Every update goes out as one chain frame carrying each device's own intensity, and only
+ * when some device's step changes.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ *
+ * @version 2.0.4
+ *
+ * @license MIT
+ *
+ * @copyright
+ * Copyright (c) 2025 Samuel Barabé
+ *
+ * Repository: https://github.com/sbarabe/SBK_MAX72xx
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+#include "SBK_MAX72xxFast.h"
+
+/**
+ * @brief Gamma 2.2 from logical level 0–255 to intensity in 4.4 fixed point (0 = step 0, 240 = step 15).
+ *
+ * The MAX72xx duty cycle runs from 1/32 (step 0) to 31/32 (step 15) in equal increments,
+ * so the curve is spread over that range: level 0 is the dimmest step, not off.
+ */
+static const uint8_t SBK_MAX72xxGamma[256] PROGMEM = {
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   2,   2,   2,   2,   2,   2,
+      2,   3,   3,   3,   3,   3,   4,   4,   4,   4,   5,   5,   5,   5,   6,   6,
+      6,   6,   7,   7,   7,   8,   8,   8,   9,   9,   9,  10,  10,  10,  11,  11,
+     11,  12,  12,  13,  13,  14,  14,  14,  15,  15,  16,  16,  17,  17,  18,  18,
+     19,  19,  20,  20,  21,  21,  22,  23,  23,  24,  24,  25,  25,  26,  27,  27,
+     28,  29,  29,  30,  31,  31,  32,  33,  33,  34,  35,  36,  36,  37,  38,  39,
+     39,  40,  41,  42,  42,  43,  44,  45,  46,  47,  47,  48,  49,  50,  51,  52,
+     53,  54,  55,  55,  56,  57,  58,  59,  60,  61,  62,  63,  64,  65,  66,  67,
+     68,  69,  70,  71,  73,  74,  75,  76,  77,  78,  79,  80,  81,  83,  84,  85,
+     86,  87,  88,  90,  91,  92,  93,  95,  96,  97,  98, 100, 101, 102, 104, 105,
+    106, 107, 109, 110, 112, 113, 114, 116, 117, 118, 120, 121, 123, 124, 126, 127,
+    129, 130, 132, 133, 135, 136, 138, 139, 141, 142, 144, 145, 147, 148, 150, 152,
+    153, 155, 157, 158, 160, 162, 163, 165, 167, 168, 170, 172, 173, 175, 177, 179,
+    180, 182, 184, 186, 188, 189, 191, 193, 195, 197, 199, 201, 202, 204, 206, 208,
+    210, 212, 214, 216, 218, 220, 222, 224, 226, 228, 230, 232, 234, 236, 238, 240};
+
+/**
+ * @class SBK_MAX72xxBrightness
+ * @brief Calibrated, gamma-corrected brightness for every device of a chain.
+ *
+ * @tparam Driver Any SBK_MAX72xx driver class (SBK_MAX72xxHard, SBK_MAX72xxSoft, ...).
+ */
+template <typename Driver>
+class SBK_MAX72xxBrightness
+{
+public:
+    /**
+     * @param driver Driver of the chain; its devices start at level 255 with no offset.
+     */
+    explicit SBK_MAX72xxBrightness(Driver &driver)
+        : _driver(driver),
+          _devsNum(driver.devsNum())
+    {
+        _offsets = new int8_t[_devsNum]();
+        _levels = new uint8_t[_devsNum];
+        _fine = new uint8_t[_devsNum];
+        _sent = new uint8_t[_devsNum];
+        memset(_levels, 255, _devsNum);
+        memset(_sent, 0xFF, _devsNum); // Unknown: the first apply() always sends
+        _refresh();
+    }
+
+    ~SBK_MAX72xxBrightness()
+    {
+        // Release the dynamically allocated memory
+        delete[] _offsets;
+        delete[] _levels;
+        delete[] _fine;
+        delete[] _sent;
+    }
+
+    /**
+     * @brief Calibration of one device, in logical levels added before the gamma curve.
+     *
+     * Positive for a panel that looks dimmer than the others, negative for a brighter one.
+     */
+    void setOffset(uint8_t devIdx, int8_t offset)
+    {
+        if (devIdx >= _devsNum)
+            return;
+        _offsets[devIdx] = offset;
+        _refresh();
+    }
+
+    /**
+     * @brief Calibration offsets of all devices at once (e.g. loaded from EEPROM).
+     */
+    void setOffsets(const int8_t *offsets)
+    {
+        if (!offsets)
+            return;
+        memcpy(_offsets, offsets, _devsNum);
+        _refresh();
+    }
+
+    int8_t offset(uint8_t devIdx) const { return devIdx < _devsNum ? _offsets[devIdx] : 0; }
+
+    /**
+     * @brief Logical brightness (0–255) of every device. Call apply() or tick() to send it.
+     */
+    void setLevel(uint8_t level)
+    {
+        memset(_levels, level, _devsNum);
+        _refresh();
+    }
+
+    /**
+     * @brief Logical brightness (0–255) of one device.
+     */
+    void setLevel(uint8_t devIdx, uint8_t level)
+    {
+        if (devIdx >= _devsNum)
+            return;
+        _levels[devIdx] = level;
+        _refresh();
+    }
+
+    uint8_t level(uint8_t devIdx) const { return devIdx < _devsNum ? _levels[devIdx] : 0; }
+
+    /**
+     * @brief Dither between adjacent steps on every tick() (off by default: nearest step).
+     */
+    void setDither(bool dither) { _dither = dither; }
+
+    /**
+     * @brief Send the intensities if a device's step changed.
+     *
+     * @return true if a frame was sent.
+     */
+    bool apply() { return _send(); }
+
+    /**
+     * @brief Advance the dithering by one tick and send the intensities if a step changed.
+     *
+     * Call at a steady rate well above 100 Hz: the fractions repeat every 16 ticks.
+     * Without dithering this is apply().
+     *
+     * @return true if a frame was sent.
+     */
+    bool tick()
+    {
+        _phase = (_phase + 1) & 0x0F;
+        return _send();
+    }
+
+private:
+    void _refresh()
+    {
+        for (uint8_t d = 0; d < _devsNum; d++)
+        {
+            int16_t v = static_cast<int16_t>(_levels[d]) + _offsets[d];
+            v = v < 0 ? 0 : (v > 255 ? 255 : v);
+            _fine[d] = SBK_MAX72xxReadFlash(SBK_MAX72xxGamma + v);
+        }
+    }
+
+    bool _send()
+    {
+        // Bit-reversed phase: the upper step is spread evenly over the 16 ticks
+        const uint8_t p = _phase;
+        const uint8_t threshold = ((p & 1) << 3) | ((p & 2) << 1) | ((p & 4) >> 1) | ((p & 8) >> 3);
+
+        bool changed = false;
+        for (uint8_t d = 0; d < _devsNum; d++)
+        {
+            uint8_t step = _fine[d] >> 4;
+            uint8_t frac = _fine[d] & 0x0F;
+            if (_dither ? frac > threshold : frac >= 8)
+                step++;
+
+            if (step != _sent[d])
+            {
+                _sent[d] = step;
+                changed = true;
+            }
+        }
+
+        if (changed)
+            _driver.setBrightness(_sent);
+        return changed;
+    }
+
+    Driver &_driver;
+    const uint8_t _devsNum;
+    int8_t *_offsets = nullptr; // Calibration per device, in logical levels
+    uint8_t *_levels = nullptr; // Logical brightness per device
+    uint8_t *_fine = nullptr;   // Intensity per device, 4.4 fixed point
+    uint8_t *_sent = nullptr;   // Step last sent per device
+    bool _dither = false;
+    uint8_t _phase = 0;
+};
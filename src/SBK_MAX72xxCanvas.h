@@ -0,0 +1,326 @@
+/**
+ * @file SBK_MAX72xxCanvas.h
+ * @brief Virtual canvas larger than the display, shown through a movable viewport.
+ *
+ * Part of the SBK_MAX72xx Arduino Library.
+ * The canvas stores column bytes (row 0 = MSB) in RAM, or reads a pre-rendered strip
+ * straight from flash. flush() reads the chain-sized window at the viewport position
+ * directly into the driver: panning by whole columns only moves an offset, panning by
+ * rows uses a shifted read of two column bytes, and nothing is redrawn. The driver only
+ * flags the digit registers whose byte changed, so a still part of a scrolling banner
+ * costs no SPI traffic either.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ *
+ * @version 2.0.4
+ *
+ * @license MIT
+ *
+ * @copyright
+ * Copyright (c) 2025 Samuel Barabé
+ *
+ * Repository: https://github.com/sbarabe/SBK_MAX72xx
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+#include "SBK_MAX72xxFast.h"
+
+/**
+ * @class SBK_MAX72xxCanvas
+ * @brief Column-byte canvas of any width (and 8-row bands), flushed through a viewport.
+ *
+ * @tparam Driver Any SBK_MAX72xx driver class (SBK_MAX72xxHard, SBK_MAX72xxSoft, ...).
+ *
+ * Canvas storage is band-major: band b (rows b×8 to b×8+7) of column x is byte b × width + x.
+ * The viewport is as wide as the chain (devsNum() × 8 columns) and 8 rows tall.
+ */
+template <typename Driver>
+class SBK_MAX72xxCanvas
+{
+public:
+    /**
+     * @brief Construct a blank RAM canvas.
+     *
+     * @param driver Driver the viewport is flushed into.
+     * @param width  Canvas width in columns.
+     * @param bands  Canvas height in 8-row bands. Default is 1.
+     */
+    SBK_MAX72xxCanvas(Driver &driver, uint16_t width, uint8_t bands = 1)
+        : _driver(driver),
+          _width(width),
+          _bands(bands ? bands : 1)
+    {
+        _pixels = new uint8_t[_width * _bands]();
+        _dirty = new uint8_t[(_width + 7) / 8]();
+        _strip = _pixels;
+    }
+
+    /**
+     * @brief Construct a read-only canvas over a pre-rendered strip.
+     *
+     * @param driver  Driver the viewport is flushed into.
+     * @param strip   Column bytes, band-major (see class description).
+     * @param width   Strip width in columns.
+     * @param bands   Strip height in 8-row bands. Default is 1.
+     * @param inFlash true if @p strip is declared PROGMEM (default).
+     */
+    SBK_MAX72xxCanvas(Driver &driver, const uint8_t *strip, uint16_t width, uint8_t bands = 1, bool inFlash = true)
+        : _driver(driver),
+          _width(width),
+          _bands(bands ? bands : 1),
+          _strip(strip),
+          _inFlash(inFlash)
+    {
+    }
+
+    ~SBK_MAX72xxCanvas()
+    {
+        // Release the dynamically allocated memory
+        delete[] _pixels;
+        delete[] _dirty;
+    }
+
+    /**
+     * @brief Canvas width in columns.
+     */
+    uint16_t width() const { return _width; }
+
+    /**
+     * @brief Canvas height in rows.
+     */
+    uint16_t height() const { return _bands * 8; }
+
+    /**
+     * @brief Viewport width in columns (the whole chain).
+     */
+    uint16_t viewWidth() const { return _driver.devsNum() * _driver.maxColumns(); }
+
+    /**
+     * @brief true for canvases built over a strip: drawing calls are ignored.
+     */
+    bool readOnly() const { return !_pixels; }
+
+    /**
+     * @brief Set one canvas pixel (RAM canvas only).
+     */
+    void setPixel(int16_t x, int16_t y, bool state)
+    {
+        if (readOnly() || x < 0 || y < 0 || x >= static_cast<int32_t>(_width) || y >= static_cast<int32_t>(height()))
+            return;
+
+        uint8_t &val = _pixels[(y / 8) * _width + x];
+        uint8_t next = state ? (val | SBK_MAX72xxRowMask[y % 8]) : (val & ~SBK_MAX72xxRowMask[y % 8]);
+        if (next != val)
+        {
+            val = next;
+            _markCol(x);
+        }
+    }
+
+    /**
+     * @brief Read one canvas pixel. Outside the canvas reads as off.
+     */
+    bool getPixel(int16_t x, int16_t y) const
+    {
+        if (x < 0 || y < 0 || x >= static_cast<int32_t>(_width) || y >= static_cast<int32_t>(height()))
+            return false;
+
+        return (_byteAt(y / 8, x) & SBK_MAX72xxRowMask[y % 8]) != 0;
+    }
+
+    /**
+     * @brief Set a whole column byte of one band (RAM canvas only).
+     */
+    void setCol(uint16_t x, uint8_t band, uint8_t value)
+    {
+        if (readOnly() || x >= _width || band >= _bands)
+            return;
+
+        uint8_t &val = _pixels[band * _width + x];
+        if (val != value)
+        {
+            val = value;
+            _markCol(x);
+        }
+    }
+
+    /**
+     * @brief Read a column byte of one band.
+     */
+    uint8_t getCol(uint16_t x, uint8_t band = 0) const
+    {
+        if (x >= _width || band >= _bands)
+            return 0;
+
+        return _byteAt(band, x);
+    }
+
+    /**
+     * @brief Write 8 rows of column @p x starting at row @p y (RAM canvas only).
+     *
+     * Same as setCol() when @p y is a multiple of 8; otherwise the byte straddles two bands.
+     * Rows falling outside the canvas are dropped.
+     *
+     * @param x     Canvas column.
+     * @param y     Canvas row receiving the MSB of @p value.
+     * @param value Column byte (row 0 = MSB).
+     */
+    void writeCol(int16_t x, int16_t y, uint8_t value)
+    {
+        if (readOnly() || x < 0 || x >= static_cast<int32_t>(_width))
+            return;
+
+        int16_t band = (y >= 0) ? y / 8 : -((7 - y) / 8);
+        uint8_t shift = y - band * 8;
+
+        if (band >= 0 && band < _bands)
+        {
+            uint8_t keep = shift ? static_cast<uint8_t>(~(0xFF >> shift)) : 0x00;
+            setCol(x, band, (_pixels[band * _width + x] & keep) | (value >> shift));
+        }
+        if (shift && band + 1 >= 0 && band + 1 < _bands)
+        {
+            uint8_t keep = 0xFF >> shift;
+            setCol(x, band + 1, (_pixels[(band + 1) * _width + x] & keep) | static_cast<uint8_t>(value << (8 - shift)));
+        }
+    }
+
+    /**
+     * @brief Blank the canvas (RAM canvas only).
+     */
+    void clear()
+    {
+        if (readOnly())
+            return;
+
+        memset(_pixels, 0, _width * _bands);
+        _viewMoved = true; // Cheaper than flagging every column
+    }
+
+    /**
+     * @brief Repeat the canvas horizontally instead of showing blank columns past its edges.
+     */
+    void setWrap(bool wrap)
+    {
+        if (_wrap != wrap)
+        {
+            _wrap = wrap;
+            _viewMoved = true;
+        }
+    }
+
+    /**
+     * @brief Move the viewport.
+     *
+     * @param x Canvas column shown on the first chain column. May be negative or past the
+     *          end (blank, or wrapped with setWrap(true)), e.g. to scroll a banner in and out.
+     * @param y Canvas row shown on row 0. Any value; rows outside the canvas are blank.
+     */
+    void setViewport(int16_t x, int16_t y = 0)
+    {
+        if (x != _viewX || y != _viewY)
+        {
+            _viewX = x;
+            _viewY = y;
+            _viewMoved = true;
+        }
+    }
+
+    /**
+     * @brief Move the viewport relative to its current position.
+     */
+    void pan(int16_t dx, int16_t dy = 0) { setViewport(_viewX + dx, _viewY + dy); }
+
+    int16_t viewX() const { return _viewX; }
+    int16_t viewY() const { return _viewY; }
+
+    /**
+     * @brief Copy the visible window into the driver buffer (no SPI traffic).
+     *
+     * After a viewport move every visible column is read again (a memory read per column,
+     * no redraw); otherwise only the canvas columns drawn since the last flush are.
+     */
+    void flush()
+    {
+        const uint16_t cols = viewWidth();
+        const uint8_t devCols = _driver.maxColumns();
+
+        for (uint16_t i = 0; i < cols; i++)
+        {
+            int32_t x = _canvasCol(static_cast<int32_t>(_viewX) + i);
+            if (!_viewMoved && (x < 0 || !_dirty || !(_dirty[x / 8] & (1 << (x % 8)))))
+                continue;
+
+            _driver.setCol(i / devCols, i % devCols, _windowCol(x));
+        }
+
+        if (_dirty)
+            memset(_dirty, 0, (_width + 7) / 8);
+        _viewMoved = false;
+    }
+
+    /**
+     * @brief flush(), then push the driver buffer to the hardware.
+     */
+    void show()
+    {
+        flush();
+        _driver.show();
+    }
+
+private:
+    void _markCol(uint16_t x) { _dirty[x / 8] |= 1 << (x % 8); }
+
+    uint8_t _byteAt(int16_t band, uint16_t x) const
+    {
+        if (band < 0 || band >= _bands)
+            return 0;
+
+        const uint8_t *p = _strip + band * _width + x;
+        return _inFlash ? SBK_MAX72xxReadFlash(p) : *p;
+    }
+
+    int32_t _canvasCol(int32_t x) const
+    {
+        // Map a viewport column to a canvas column, -1 when blank
+        if (_wrap && _width)
+        {
+            x %= _width;
+            return x < 0 ? x + _width : x;
+        }
+        return (x < 0 || x >= _width) ? -1 : x;
+    }
+
+    uint8_t _windowCol(int32_t x) const
+    {
+        if (x < 0)
+            return 0;
+
+        // Row offset: whole bands pick the byte, the remainder shifts two bands together
+        int16_t band = (_viewY >= 0) ? _viewY / 8 : -((7 - _viewY) / 8);
+        uint8_t shift = _viewY - band * 8;
+
+        uint8_t value = _byteAt(band, x);
+        if (!shift)
+            return value;
+
+        return (value << shift) | (_byteAt(band + 1, x) >> (8 - shift));
+    }
+
+    Driver &_driver;
+    const uint16_t _width;
+    const uint8_t _bands;
+    uint8_t *_pixels = nullptr; // RAM canvas storage, nullptr for a strip canvas
+    uint8_t *_dirty = nullptr;  // One bit per canvas column drawn since the last flush
+    const uint8_t *_strip = nullptr;
+    const bool _inFlash = false;
+
+    int16_t _viewX = 0;
+    int16_t _viewY = 0;
+    bool _wrap = false;
+    bool _viewMoved = true; // First flush writes the whole window
+};
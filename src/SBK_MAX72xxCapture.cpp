@@ -0,0 +1,242 @@
+/**
+ * @file SBK_MAX72xxCapture.cpp
+ * @brief Implementation of the SBK_MAX72xxCapture SPI frame recorder.
+ *
+ * Part of the SBK_MAX72xx Arduino Library.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ *
+ * @version 2.0.4
+ *
+ * @license MIT
+ *
+ * Copyright (c) 2025 Samuel Barabé
+ */
+
+#include "SBK_MAX72xxCapture.h"
+#include "SBK_MAX72xxChainSim.h"
+
+SBK_MAX72xxCapture::SBK_MAX72xxCapture(uint16_t capacity)
+    : _capacity(capacity)
+{
+    if (_capacity)
+        _frames = new Frame[_capacity];
+}
+
+SBK_MAX72xxCapture::SBK_MAX72xxCapture(Print &out)
+    : _stream(&out)
+{
+}
+
+SBK_MAX72xxCapture::~SBK_MAX72xxCapture()
+{
+    // Release the dynamically allocated memory
+    delete[] _frames;
+}
+
+void SBK_MAX72xxCapture::clear()
+{
+    _head = 0;
+    _count = 0;
+    _dropped = 0;
+    _inFrame = false;
+}
+
+const SBK_MAX72xxCapture::Frame *SBK_MAX72xxCapture::frame(uint16_t idx) const
+{
+    if (idx >= _count)
+        return nullptr;
+
+    uint16_t slot = (_head + _capacity - _count + idx) % _capacity;
+    return &_frames[slot];
+}
+
+void SBK_MAX72xxCapture::beginFrame()
+{
+    if (!_enabled)
+        return;
+
+    _current.timeUs = micros();
+    _current.len = 0;
+    _inFrame = true;
+}
+
+void SBK_MAX72xxCapture::push(uint8_t data)
+{
+    if (!_inFrame || _current.len >= maxFrameBytes)
+        return;
+
+    _current.data[_current.len++] = data;
+}
+
+void SBK_MAX72xxCapture::endFrame()
+{
+    if (!_inFrame)
+        return;
+    _inFrame = false;
+
+    record(_current);
+}
+
+void SBK_MAX72xxCapture::record(const Frame &frame)
+{
+    if (_stream)
+    {
+        printFrame(*_stream, frame);
+        return;
+    }
+
+    if (!_capacity)
+        return;
+
+    _frames[_head] = frame;
+    _head = (_head + 1) % _capacity;
+
+    if (_count < _capacity)
+        _count++;
+    else
+        _dropped++;
+}
+
+void SBK_MAX72xxCapture::printFrame(Print &out, const Frame &frame)
+{
+    out.print(frame.timeUs);
+    for (uint8_t i = 0; i < frame.len; i++)
+    {
+        out.print(' ');
+        _printHex(out, frame.data[i]);
+    }
+    out.println();
+}
+
+void SBK_MAX72xxCapture::printFrames(Print &out) const
+{
+    for (uint16_t i = 0; i < _count; i++)
+        printFrame(out, *frame(i));
+
+    if (_dropped)
+    {
+        out.print("# dropped ");
+        out.println(_dropped);
+    }
+}
+
+void SBK_MAX72xxCapture::printRegisters(Print &out) const
+{
+    // Frames shift through the longest chain a frame can address; shorter chains use its first devices
+    SBK_MAX72xxChainSim chain(maxFrameBytes / 2);
+    uint8_t devsNum = 0;
+
+    for (uint16_t f = 0; f < _count; f++)
+    {
+        const Frame *fr = frame(f);
+        if (fr->len / 2 > devsNum)
+            devsNum = fr->len / 2;
+        chain.frame(fr->data, fr->len);
+    }
+
+    for (uint8_t devIdx = 0; devIdx < devsNum; devIdx++)
+    {
+        out.print("dev ");
+        out.print(devIdx);
+        out.print(':');
+        for (uint8_t opcode = 0x01; opcode < SBK_MAX72xxChainSim::registersNum; opcode++)
+        {
+            if (opcode == 0x0D || opcode == 0x0E)
+                continue; // Unused addresses
+
+            out.print(opcode == 0x09 ? " | " : " ");
+            if (chain.written(devIdx, opcode))
+                _printHex(out, chain.reg(devIdx, opcode));
+            else
+                out.print("--");
+        }
+        out.println();
+    }
+}
+
+void SBK_MAX72xxCapture::writeVCD(Print &out, uint32_t clockHz) const
+{
+    uint32_t halfNs = clockHz ? 500000000UL / clockHz : 500;
+    if (halfNs == 0)
+        halfNs = 1;
+
+    out.println("$timescale 1ns $end");
+    out.println("$scope module max72xx $end");
+    out.println("$var wire 1 c CS $end");
+    out.println("$var wire 1 k CLK $end");
+    out.println("$var wire 1 d DIN $end");
+    out.println("$upscope $end");
+    out.println("$enddefinitions $end");
+    out.println("$dumpvars 1c 0k 0d $end");
+
+    uint64_t t = 0;
+    uint64_t shown = 0; // Last timestamp written, so each one appears once
+    bool din = false;
+
+    for (uint16_t f = 0; f < _count; f++)
+    {
+        const Frame *fr = frame(f);
+
+        // Frames can't overlap: a late timestamp only ever delays the next CS edge
+        uint64_t start = (uint64_t)fr->timeUs * 1000;
+        if (start > t)
+            t = start;
+
+        _printTime(out, t, shown);
+        out.println("0c");
+
+        for (uint8_t i = 0; i < fr->len; i++)
+        {
+            for (int8_t bit = 7; bit >= 0; bit--)
+            {
+                bool level = (fr->data[i] >> bit) & 0x01;
+                if (level != din)
+                {
+                    _printTime(out, t, shown);
+                    out.println(level ? "1d" : "0d");
+                    din = level;
+                }
+                t += halfNs;
+                _printTime(out, t, shown);
+                out.println("1k"); // MAX72xx latches DIN on the rising edge
+                t += halfNs;
+                _printTime(out, t, shown);
+                out.println("0k");
+            }
+        }
+
+        t += halfNs;
+        _printTime(out, t, shown);
+        out.println("1c"); // Data is loaded into the registers on CS rising edge
+        t += halfNs;
+    }
+}
+
+void SBK_MAX72xxCapture::_printHex(Print &out, uint8_t value)
+{
+    if (value < 0x10)
+        out.print('0');
+    out.print(value, HEX);
+}
+
+void SBK_MAX72xxCapture::_printTime(Print &out, uint64_t timeNs, uint64_t &shown)
+{
+    if (timeNs == shown && timeNs != 0)
+        return;
+    shown = timeNs;
+
+    // Print has no 64-bit overload; timestamps pass 2^32 ns after ~4 s
+    char buf[21];
+    uint8_t pos = sizeof(buf) - 1;
+    buf[pos] = '\0';
+    do
+    {
+        buf[--pos] = '0' + (timeNs % 10);
+        timeNs /= 10;
+    } while (timeNs);
+
+    out.print('#');
+    out.println(&buf[pos]);
+}
@@ -0,0 +1,159 @@
+/**
+ * @file SBK_MAX72xxCapture.h
+ * @brief SPI frame recorder for diagnosing MAX7219/MAX7221 chain traffic.
+ *
+ * Part of the SBK_MAX72xx Arduino Library.
+ * Attach a capture to any SBK_MAX72xx driver with setCapture() to log every
+ * chip-select frame (timestamp + bytes) into a RAM ring buffer, or stream it to a Print.
+ * Captured traffic can be dumped as text, replayed through the chain simulator
+ * (SBK_MAX72xxChainSim), or exported as a VCD waveform (CS/CLK/DIN) that opens in GTKWave.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ *
+ * @version 2.0.4
+ *
+ * @license MIT
+ *
+ * @copyright
+ * Copyright (c) 2025 Samuel Barabé
+ *
+ * Repository: https://github.com/sbarabe/SBK_MAX72xx
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * @class SBK_MAX72xxCapture
+ * @brief Records the CS frames sent by a SBK_MAX72xx driver.
+ */
+class SBK_MAX72xxCapture
+{
+public:
+    /// Largest frame on a chain: 8 devices × (opcode + data).
+    static constexpr uint8_t maxFrameBytes = 16;
+
+    /**
+     * @brief One chip-select frame as seen on the wire.
+     */
+    struct Frame
+    {
+        uint32_t timeUs;             ///< micros() when CS went LOW.
+        uint8_t len;                 ///< Number of bytes shifted out.
+        uint8_t data[maxFrameBytes]; ///< Bytes in wire order (last device first).
+    };
+
+    /**
+     * @brief Construct a ring-buffer capture.
+     *
+     * @param capacity Number of frames kept in RAM (oldest frames are overwritten).
+     *                 Each frame uses sizeof(Frame) = 21 bytes.
+     */
+    explicit SBK_MAX72xxCapture(uint16_t capacity = 16);
+
+    /**
+     * @brief Construct a streaming capture.
+     *
+     * Every frame is printed to @p out as soon as CS goes HIGH (see printFrame()),
+     * e.g. to Serial or an SD card File. Nothing is kept in RAM.
+     *
+     * @note Printing happens inside show(), which slows the flush accordingly.
+     */
+    explicit SBK_MAX72xxCapture(Print &out);
+
+    ~SBK_MAX72xxCapture(); // Destructor
+
+    /**
+     * @brief Pause or resume recording. Recording is enabled by default.
+     */
+    void setEnabled(bool enable) { _enabled = enable; }
+
+    /**
+     * @brief Drop all recorded frames and reset the overflow counter.
+     */
+    void clear();
+
+    /**
+     * @brief Number of frames currently held in the ring buffer.
+     */
+    uint16_t size() const { return _count; }
+
+    /**
+     * @brief Ring buffer capacity in frames (0 for a streaming capture).
+     */
+    uint16_t capacity() const { return _capacity; }
+
+    /**
+     * @brief Number of frames overwritten since the last clear().
+     */
+    uint32_t dropped() const { return _dropped; }
+
+    /**
+     * @brief Access a recorded frame.
+     *
+     * @param idx 0 = oldest frame still held, size() - 1 = most recent.
+     * @return Pointer to the frame, or nullptr if @p idx is out of range.
+     */
+    const Frame *frame(uint16_t idx) const;
+
+    /**
+     * @brief Print one frame as `<timeUs> <hex bytes...>` on a single line.
+     */
+    static void printFrame(Print &out, const Frame &frame);
+
+    /**
+     * @brief Print every recorded frame, oldest first (see printFrame()).
+     */
+    void printFrames(Print &out) const;
+
+    /**
+     * @brief Replay the recorded frames through SBK_MAX72xxChainSim and print the result.
+     *
+     * Each line shows one device's latched registers (DIG0–DIG7, decode mode, intensity,
+     * scan limit, shutdown, display test) as they would be after the last captured frame.
+     * Registers never written since the capture started are shown as `--`.
+     */
+    void printRegisters(Print &out) const;
+
+    /**
+     * @brief Export the recorded frames as a Value Change Dump (VCD) of CS, CLK and DIN.
+     *
+     * Frames are placed at their captured timestamps; bit timing inside a frame is
+     * reconstructed from @p clockHz (SPI mode 0, MSB first), so the waveform shows real
+     * refresh rates and gaps between frames without a logic analyzer.
+     *
+     * @param out     Destination (Serial, File...). Save the output as a `.vcd` file.
+     * @param clockHz SPI clock used by the driver (e.g. 1000000).
+     */
+    void writeVCD(Print &out, uint32_t clockHz = 1000000) const;
+
+    /**
+     * @brief Add a complete frame as if a driver had just sent it (e.g. one read back
+     *        from a printFrames() log). Streamed or stored like any other frame.
+     */
+    void record(const Frame &frame);
+
+    /**
+     * @brief Driver hooks: called around every chip-select frame.
+     */
+    void beginFrame();
+    void push(uint8_t data);
+    void endFrame();
+
+private:
+    static void _printHex(Print &out, uint8_t value);
+    static void _printTime(Print &out, uint64_t timeNs, uint64_t &shown);
+
+    Frame *_frames = nullptr;
+    Frame _current;
+    Print *_stream = nullptr;
+
+    const uint16_t _capacity = 0;
+    uint16_t _head = 0; // Next slot to write
+    uint16_t _count = 0;
+    uint32_t _dropped = 0;
+    bool _enabled = true;
+    bool _inFrame = false;
+};
@@ -0,0 +1,165 @@
+/**
+ * @file SBK_MAX72xxChainSim.h
+ * @brief Portable model of a MAX7219/MAX7221 daisy chain: bytes shifted through N devices, latched on CS.
+ *
+ * Part of the SBK_MAX72xx Arduino Library.
+ * Each device is a 16-bit shift register whose overflow feeds the next device, device 0
+ * being the one wired to the controller's DIN. On the chip select rising edge every device
+ * decodes the opcode/data pair it holds into its registers, as the datasheet describes.
+ * SBK_MAX72xxCapture replays captured frames through it, the Linux fake-device mode latches
+ * its frames into it, and the host tests in extras/test compare drivers against it.
+ * The model has no hardware dependency.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ *
+ * @version 2.0.4
+ *
+ * @license MIT
+ *
+ * @copyright
+ * Copyright (c) 2025 Samuel Barabé
+ *
+ * Repository: https://github.com/sbarabe/SBK_MAX72xx
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * @class SBK_MAX72xxChainSim
+ * @brief Shift registers and latched registers (0x00–0x0F) of every device of a chain.
+ */
+class SBK_MAX72xxChainSim
+{
+public:
+    /// Register addresses per device (0x00 NOOP to 0x0F display test).
+    static constexpr uint8_t registersNum = 16;
+
+    /**
+     * @param devsNum Number of devices in the chain (at least 1).
+     */
+    explicit SBK_MAX72xxChainSim(uint8_t devsNum)
+        : _devsNum(devsNum ? devsNum : 1)
+    {
+        _shift = new uint16_t[_devsNum]();
+        _written = new uint16_t[_devsNum]();
+        _regs = new uint8_t[_devsNum * registersNum]();
+    }
+
+    ~SBK_MAX72xxChainSim()
+    {
+        // Release the dynamically allocated memory
+        delete[] _regs;
+        delete[] _written;
+        delete[] _shift;
+    }
+
+    /**
+     * @brief Number of devices in the chain.
+     */
+    uint8_t devsNum() const { return _devsNum; }
+
+    /**
+     * @brief Power-on state: empty shift registers, no register written, counters at 0.
+     */
+    void reset()
+    {
+        memset(_shift, 0, _devsNum * sizeof(uint16_t));
+        memset(_written, 0, _devsNum * sizeof(uint16_t));
+        memset(_regs, 0, _devsNum * registersNum);
+        _bytes = 0;
+        _frames = 0;
+    }
+
+    /**
+     * @brief Clock one byte into DIN, MSB first (CS held LOW).
+     *
+     * The byte enters device 0 and pushes the oldest byte of every device into the next one.
+     */
+    void shift(uint8_t data)
+    {
+        for (uint8_t devIdx = _devsNum - 1; devIdx > 0; devIdx--)
+            _shift[devIdx] = static_cast<uint16_t>((_shift[devIdx] << 8) | (_shift[devIdx - 1] >> 8));
+        _shift[0] = static_cast<uint16_t>((_shift[0] << 8) | data);
+        _bytes++;
+    }
+
+    /**
+     * @brief CS rising edge: every device loads the register addressed by its shift register.
+     */
+    void latch()
+    {
+        for (uint8_t devIdx = 0; devIdx < _devsNum; devIdx++)
+        {
+            uint8_t opcode = (_shift[devIdx] >> 8) & 0x0F; // D15–D12 are don't care
+            if (opcode == 0x00)
+                continue; // NOOP
+
+            _regs[devIdx * registersNum + opcode] = _shift[devIdx] & 0xFF;
+            _written[devIdx] |= static_cast<uint16_t>(1u << opcode);
+        }
+        _frames++;
+    }
+
+    /**
+     * @brief Shift a whole chip-select frame in wire order, then latch it.
+     */
+    void frame(const uint8_t *data, uint16_t len)
+    {
+        for (uint16_t i = 0; i < len; i++)
+            shift(data[i]);
+        latch();
+    }
+
+    /**
+     * @brief Latched value of a register (0 if never written or out of range).
+     */
+    uint8_t reg(uint8_t devIdx, uint8_t opcode) const
+    {
+        if (devIdx >= _devsNum || opcode >= registersNum)
+            return 0;
+        return _regs[devIdx * registersNum + opcode];
+    }
+
+    /**
+     * @brief true once a register has been loaded by a latch().
+     */
+    bool written(uint8_t devIdx, uint8_t opcode) const
+    {
+        if (devIdx >= _devsNum || opcode >= registersNum)
+            return false;
+        return _written[devIdx] & (1u << opcode);
+    }
+
+    /**
+     * @brief true if both chains hold the same registers, written or not, on every device.
+     */
+    bool sameRegisters(const SBK_MAX72xxChainSim &other) const
+    {
+        if (other._devsNum != _devsNum)
+            return false;
+        return memcmp(_regs, other._regs, _devsNum * registersNum) == 0 &&
+               memcmp(_written, other._written, _devsNum * sizeof(uint16_t)) == 0;
+    }
+
+    /**
+     * @brief Bytes clocked in since construction or reset().
+     */
+    uint32_t bytes() const { return _bytes; }
+
+    /**
+     * @brief Chip-select frames latched since construction or reset().
+     */
+    uint32_t frames() const { return _frames; }
+
+private:
+    const uint8_t _devsNum;
+    uint16_t *_shift = nullptr;   // Shift register of each device, device 0 nearest DIN
+    uint16_t *_written = nullptr; // One bit per register loaded at least once
+    uint8_t *_regs = nullptr;     // registersNum latched registers per device
+    uint32_t _bytes = 0;
+    uint32_t _frames = 0;
+};
@@ -0,0 +1,192 @@
+/**
+ * @file SBK_MAX72xxColor.h
+ * @brief Bi-color and RGB framebuffer: one bit-plane per color channel over paired chips.
+ *
+ * Part of the SBK_MAX72xx Arduino Library.
+ * Bi-color modules drive their red and green LEDs from two MAX72xx, RGB modules from three.
+ * The framebuffer keeps one plane of column bytes per channel and maps plane p of module m
+ * onto its own device of the chain. flush() hands every plane to the driver, whose show()
+ * sends each changed digit as one chain-wide frame covering all devices: the red, green
+ * (and blue) columns of a digit latch together, so colors change atomically.
+ * Planes are stored one after the other (plane-major), so shades by bit-angle modulation
+ * can later add sub-planes per channel without changing the device mapping.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ *
+ * @version 2.0.4
+ *
+ * @license MIT
+ *
+ * @copyright
+ * Copyright (c) 2025 Samuel Barabé
+ *
+ * Repository: https://github.com/sbarabe/SBK_MAX72xx
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+#include "SBK_MAX72xxFast.h"
+
+/**
+ * @brief Colors as plane masks: bit p lights plane p (plane 0 = red, 1 = green, 2 = blue).
+ */
+enum SBK_MAX72xxColor : uint8_t
+{
+    SBK_MAX72xxBlack = 0x00,
+    SBK_MAX72xxRed = 0x01,
+    SBK_MAX72xxGreen = 0x02,
+    SBK_MAX72xxYellow = 0x03, ///< Red + green (orange on most bi-color modules)
+    SBK_MAX72xxBlue = 0x04,
+    SBK_MAX72xxMagenta = 0x05,
+    SBK_MAX72xxCyan = 0x06,
+    SBK_MAX72xxWhite = 0x07
+};
+
+/**
+ * @class SBK_MAX72xxColorFrame
+ * @brief Color framebuffer of 8-row modules, one bit-plane per channel.
+ *
+ * @tparam Driver Any SBK_MAX72xx driver class (SBK_MAX72xxHard, SBK_MAX72xxSoft, ...).
+ * @tparam Planes Color channels per module: 2 for bi-color, 3 for RGB.
+ *
+ * The chain holds devsNum() / Planes modules. Interleaved wiring (the default) puts the
+ * planes of a module on consecutive devices: device = module × Planes + plane. Grouped
+ * wiring puts all modules of plane 0 first: device = plane × modules + module.
+ * Columns are numbered across modules: x = module × 8 + colIdx, row 0 = MSB.
+ */
+template <typename Driver, uint8_t Planes = 2>
+class SBK_MAX72xxColorFrame
+{
+public:
+    /**
+     * @param driver      Driver of the whole chain.
+     * @param interleaved true if each module's planes are consecutive devices.
+     */
+    explicit SBK_MAX72xxColorFrame(Driver &driver, bool interleaved = true)
+        : _driver(driver),
+          _modules(driver.devsNum() / Planes),
+          _width(_modules * driver.maxColumns()),
+          _interleaved(interleaved)
+    {
+        _planes = new uint8_t[Planes * _width]();
+    }
+
+    ~SBK_MAX72xxColorFrame()
+    {
+        // Release the dynamically allocated memory
+        delete[] _planes;
+    }
+
+    /**
+     * @brief Width in columns (modules × 8).
+     */
+    uint16_t width() const { return _width; }
+
+    /**
+     * @brief Column bytes of one plane (width() bytes), for direct drawing.
+     */
+    uint8_t *plane(uint8_t p) { return p < Planes ? _planes + p * _width : nullptr; }
+
+    /**
+     * @brief Set one pixel to @p color (buffer only).
+     */
+    void setPixel(uint16_t x, uint8_t y, uint8_t color)
+    {
+        if (x >= _width || y >= 8)
+            return;
+
+        const uint8_t mask = SBK_MAX72xxRowMask[y];
+        for (uint8_t p = 0; p < Planes; p++)
+        {
+            uint8_t &col = _planes[p * _width + x];
+            col = (color & (1 << p)) ? (col | mask) : (col & ~mask);
+        }
+    }
+
+    /**
+     * @brief Color of one pixel (SBK_MAX72xxBlack if out of range).
+     */
+    uint8_t getPixel(uint16_t x, uint8_t y) const
+    {
+        if (x >= _width || y >= 8)
+            return SBK_MAX72xxBlack;
+
+        uint8_t color = 0;
+        for (uint8_t p = 0; p < Planes; p++)
+        {
+            if (_planes[p * _width + x] & SBK_MAX72xxRowMask[y])
+                color |= 1 << p;
+        }
+        return color;
+    }
+
+    /**
+     * @brief Paint the rows set in @p rows of column @p x with @p color; other rows are kept.
+     *
+     * Draws a font or bitmap column in a color with one masked write per plane.
+     */
+    void drawCol(uint16_t x, uint8_t rows, uint8_t color)
+    {
+        if (x >= _width)
+            return;
+
+        for (uint8_t p = 0; p < Planes; p++)
+        {
+            uint8_t &col = _planes[p * _width + x];
+            col = (color & (1 << p)) ? (col | rows) : (col & ~rows);
+        }
+    }
+
+    /**
+     * @brief Paint every pixel with @p color.
+     */
+    void fill(uint8_t color)
+    {
+        for (uint8_t p = 0; p < Planes; p++)
+            memset(_planes + p * _width, (color & (1 << p)) ? 0xFF : 0x00, _width);
+    }
+
+    /**
+     * @brief Turn every pixel off (buffer only).
+     */
+    void clear() { fill(SBK_MAX72xxBlack); }
+
+    /**
+     * @brief Copy every plane into the driver buffer (no SPI traffic).
+     *
+     * The driver only marks the digits whose byte changed on some device.
+     */
+    void flush()
+    {
+        const uint8_t devCols = _driver.maxColumns();
+        for (uint8_t p = 0; p < Planes; p++)
+        {
+            const uint8_t *cols = _planes + p * _width;
+            for (uint16_t m = 0; m < _modules; m++)
+            {
+                uint8_t dev = _interleaved ? m * Planes + p : p * _modules + m;
+                for (uint8_t c = 0; c < devCols; c++)
+                    _driver.setCol(dev, c, cols[m * devCols + c]);
+            }
+        }
+    }
+
+    /**
+     * @brief flush() then show(): all planes of a changed digit go out in the same frame.
+     */
+    void show()
+    {
+        flush();
+        _driver.show();
+    }
+
+private:
+    Driver &_driver;
+    const uint16_t _modules;
+    const uint16_t _width;
+    const bool _interleaved;
+    uint8_t *_planes = nullptr; // Planes × width column bytes, plane-major
+};
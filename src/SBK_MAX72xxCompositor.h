@@ -0,0 +1,327 @@
+/**
+ * @file SBK_MAX72xxCompositor.h
+ * @brief Layered 1-bpp compositor for any SBK_MAX72xx driver.
+ *
+ * Part of the SBK_MAX72xx Arduino Library.
+ * Each layer owns a column-byte buffer the width of the chain, a visibility flag and a
+ * blend operation. Layers track their own dirty columns, and flush() recomposites only
+ * those columns into the driver buffer, bottom layer first. Toggling a cursor layer
+ * recomputes just the columns the cursor covers.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ *
+ * @version 2.0.4
+ *
+ * @license MIT
+ *
+ * @copyright
+ * Copyright (c) 2025 Samuel Barabé
+ *
+ * Repository: https://github.com/sbarabe/SBK_MAX72xx
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * @brief How a layer is combined with the layers below it.
+ */
+enum class SBK_MAX72xxBlend : uint8_t
+{
+    Or,      ///< Lit pixels are added
+    MaskOut, ///< Lit pixels switch off what is below (AND-NOT)
+    Xor,     ///< Lit pixels invert what is below
+    Opaque   ///< Pixels replace what is below where the layer mask is set (whole layer if no mask)
+};
+
+/**
+ * @class SBK_MAX72xxCompositor
+ * @brief Stacks up to MaxLayers 1-bpp layers and composites changed columns into a driver.
+ *
+ * @tparam Driver    Any SBK_MAX72xx driver class (SBK_MAX72xxHard, SBK_MAX72xxSoft, ...).
+ * @tparam MaxLayers Maximum number of layers.
+ *
+ * Columns are numbered chain-wide: x = devIdx × 8 + colIdx. Rows follow the driver (row 0 = MSB).
+ */
+template <typename Driver, uint8_t MaxLayers = 4>
+class SBK_MAX72xxCompositor
+{
+public:
+    /// Returned by addLayer() when no layer could be created.
+    static constexpr uint8_t noLayer = 0xFF;
+
+    /**
+     * @brief Construct a compositor covering the whole chain of @p driver.
+     *
+     * @param driver Driver to composite into. Its devsNum() sets the width.
+     */
+    explicit SBK_MAX72xxCompositor(Driver &driver)
+        : _driver(driver),
+          _width(driver.devsNum() * driver.maxColumns())
+    {
+    }
+
+    ~SBK_MAX72xxCompositor()
+    {
+        // Release the dynamically allocated memory
+        for (uint8_t i = 0; i < _layersNum; i++)
+        {
+            delete[] _layers[i].pixels;
+            delete[] _layers[i].mask;
+            delete[] _layers[i].dirty;
+        }
+    }
+
+    /**
+     * @brief Width of every layer, in columns.
+     */
+    uint16_t width() const { return _width; }
+
+    /**
+     * @brief Number of layers created so far.
+     */
+    uint8_t layersNum() const { return _layersNum; }
+
+    /**
+     * @brief Add a blank, visible layer on top of the existing ones.
+     *
+     * @param blend Blend operation of the new layer.
+     * @return Layer index, or noLayer if MaxLayers is reached.
+     */
+    uint8_t addLayer(SBK_MAX72xxBlend blend = SBK_MAX72xxBlend::Or)
+    {
+        if (_layersNum >= MaxLayers)
+            return noLayer;
+
+        Layer &l = _layers[_layersNum];
+        l.pixels = new uint8_t[_width]();
+        l.dirty = new uint8_t[_dirtyBytes()]();
+        l.blend = blend;
+        l.visible = true;
+        _dirtyContent(l);
+        return _layersNum++;
+    }
+
+    /**
+     * @brief Change how a layer is blended.
+     */
+    void setBlend(uint8_t layer, SBK_MAX72xxBlend blend)
+    {
+        if (layer >= _layersNum || _layers[layer].blend == blend)
+            return;
+
+        Layer &l = _layers[layer];
+        _dirtyContent(l); // Columns affected under the old blend...
+        l.blend = blend;
+        _dirtyContent(l); // ...and under the new one
+    }
+
+    /**
+     * @brief Show or hide a layer. Only the columns the layer affects are recomposited.
+     */
+    void setVisible(uint8_t layer, bool visible)
+    {
+        if (layer >= _layersNum || _layers[layer].visible == visible)
+            return;
+
+        Layer &l = _layers[layer];
+        l.visible = true; // So _dirtyContent() does not skip it
+        _dirtyContent(l);
+        l.visible = visible;
+    }
+
+    /**
+     * @brief Check whether a layer is visible.
+     */
+    bool visible(uint8_t layer) const { return layer < _layersNum && _layers[layer].visible; }
+
+    /**
+     * @brief Set one pixel of a layer.
+     *
+     * @param layer Layer index.
+     * @param x     Chain-wide column.
+     * @param y     Row (0–7).
+     * @param state true = lit.
+     */
+    void setPixel(uint8_t layer, uint16_t x, uint8_t y, bool state)
+    {
+        if (layer >= _layersNum || x >= _width || y >= 8)
+            return;
+
+        uint8_t bit = 0x80 >> y;
+        uint8_t value = _layers[layer].pixels[x];
+        setCol(layer, x, state ? (value | bit) : (value & ~bit));
+    }
+
+    /**
+     * @brief Set a whole column byte of a layer.
+     */
+    void setCol(uint8_t layer, uint16_t x, uint8_t value)
+    {
+        if (layer >= _layersNum || x >= _width)
+            return;
+
+        Layer &l = _layers[layer];
+        if (l.pixels[x] != value)
+        {
+            l.pixels[x] = value;
+            if (l.visible)
+                _dirtyCol(l, x);
+        }
+    }
+
+    /**
+     * @brief Read a column byte of a layer.
+     */
+    uint8_t getCol(uint8_t layer, uint16_t x) const
+    {
+        if (layer >= _layersNum || x >= _width)
+            return 0;
+
+        return _layers[layer].pixels[x];
+    }
+
+    /**
+     * @brief Set the opacity mask of a column, used by SBK_MAX72xxBlend::Opaque.
+     *
+     * The mask buffer is allocated on first use, fully opaque (0xFF).
+     *
+     * @param layer Layer index.
+     * @param x     Chain-wide column.
+     * @param mask  Rows where the layer replaces what is below (row 0 = MSB).
+     */
+    void setMaskCol(uint8_t layer, uint16_t x, uint8_t mask)
+    {
+        if (layer >= _layersNum || x >= _width)
+            return;
+
+        Layer &l = _layers[layer];
+        if (!l.mask)
+        {
+            l.mask = new uint8_t[_width];
+            memset(l.mask, 0xFF, _width);
+        }
+        if (l.mask[x] != mask)
+        {
+            l.mask[x] = mask;
+            if (l.visible && l.blend == SBK_MAX72xxBlend::Opaque)
+                _dirtyCol(l, x);
+        }
+    }
+
+    /**
+     * @brief Blank a layer (its mask is kept).
+     */
+    void clearLayer(uint8_t layer)
+    {
+        if (layer >= _layersNum)
+            return;
+
+        Layer &l = _layers[layer];
+        _dirtyContent(l);
+        memset(l.pixels, 0, _width);
+    }
+
+    /**
+     * @brief Composite every dirty column into the driver buffer (no SPI traffic).
+     *
+     * The driver only flags the columns whose byte actually changed, so its show()
+     * then sends just those digit registers.
+     */
+    void flush()
+    {
+        for (uint16_t b = 0; b < _dirtyBytes(); b++)
+        {
+            uint8_t pending = 0;
+            for (uint8_t i = 0; i < _layersNum; i++)
+            {
+                pending |= _layers[i].dirty[b];
+                _layers[i].dirty[b] = 0;
+            }
+
+            for (uint8_t bit = 0; pending; bit++, pending >>= 1)
+            {
+                if (pending & 0x01)
+                    _compositeCol(b * 8 + bit);
+            }
+        }
+    }
+
+    /**
+     * @brief flush(), then push the driver buffer to the hardware.
+     */
+    void show()
+    {
+        flush();
+        _driver.show();
+    }
+
+private:
+    struct Layer
+    {
+        uint8_t *pixels = nullptr; // Column bytes, one per chain column
+        uint8_t *mask = nullptr;   // Opaque-blend mask, allocated on first setMaskCol()
+        uint8_t *dirty = nullptr;  // One bit per column to recomposite
+        SBK_MAX72xxBlend blend = SBK_MAX72xxBlend::Or;
+        bool visible = true;
+    };
+
+    uint16_t _dirtyBytes() const { return (_width + 7) / 8; }
+
+    void _dirtyCol(Layer &l, uint16_t x) { l.dirty[x / 8] |= 1 << (x % 8); }
+
+    void _dirtyContent(Layer &l)
+    {
+        // Flag only the columns this layer changes when composited
+        if (!l.visible)
+            return;
+
+        for (uint16_t x = 0; x < _width; x++)
+        {
+            bool affects = (l.blend == SBK_MAX72xxBlend::Opaque) ? (!l.mask || l.mask[x]) : (l.pixels[x] != 0);
+            if (affects)
+                _dirtyCol(l, x);
+        }
+    }
+
+    void _compositeCol(uint16_t x)
+    {
+        uint8_t value = 0;
+        for (uint8_t i = 0; i < _layersNum; i++)
+        {
+            const Layer &l = _layers[i];
+            if (!l.visible)
+                continue;
+
+            uint8_t px = l.pixels[x];
+            switch (l.blend)
+            {
+            case SBK_MAX72xxBlend::Or:
+                value |= px;
+                break;
+            case SBK_MAX72xxBlend::MaskOut:
+                value &= ~px;
+                break;
+            case SBK_MAX72xxBlend::Xor:
+                value ^= px;
+                break;
+            case SBK_MAX72xxBlend::Opaque:
+            {
+                uint8_t mask = l.mask ? l.mask[x] : 0xFF;
+                value = (value & ~mask) | (px & mask);
+                break;
+            }
+            }
+        }
+
+        _driver.setCol(x / _driver.maxColumns(), x % _driver.maxColumns(), value);
+    }
+
+    Driver &_driver;
+    const uint16_t _width;
+    Layer _layers[MaxLayers];
+    uint8_t _layersNum = 0;
+};
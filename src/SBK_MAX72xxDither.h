@@ -0,0 +1,93 @@
+/**
+ * @file SBK_MAX72xxDither.h
+ * @brief Ordered (Bayer 8x8) dithering of 8-bit grayscale into 1-bpp column bytes.
+ *
+ * Part of the SBK_MAX72xx Arduino Library.
+ * Grayscale is converted one 8x8 block at a time: each row of 8 pixels is compared with
+ * its precomputed threshold row and packed into a row byte, then the 8 row bytes are
+ * transposed into the 8 column bytes the driver stores. A 32x8 frame is 256 compares and
+ * four transposes, small enough for live video. The header does not depend on Arduino,
+ * so host tools can produce the exact same bytes offline.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ *
+ * @version 2.0.4
+ *
+ * @license MIT
+ *
+ * @copyright
+ * Copyright (c) 2025 Samuel Barabé
+ *
+ * Repository: https://github.com/sbarabe/SBK_MAX72xx
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "SBK_MAX72xxFast.h"
+
+/**
+ * @brief 8x8 Bayer thresholds [row][column], scaled to 0–255: a pixel is lit when gray >= threshold.
+ */
+static constexpr uint8_t SBK_MAX72xxBayer8x8[8][8] = {
+    {2, 130, 34, 162, 10, 138, 42, 170},
+    {194, 66, 226, 98, 202, 74, 234, 106},
+    {50, 178, 18, 146, 58, 186, 26, 154},
+    {242, 114, 210, 82, 250, 122, 218, 90},
+    {14, 142, 46, 174, 6, 134, 38, 166},
+    {206, 78, 238, 110, 198, 70, 230, 102},
+    {62, 190, 30, 158, 54, 182, 22, 150},
+    {254, 126, 222, 94, 246, 118, 214, 86}};
+
+/**
+ * @brief Dither one 8x8 grayscale block into 8 column bytes (row 0 = MSB).
+ *
+ * @param gray   Top-left pixel of the block, rows @p stride bytes apart.
+ * @param stride Bytes between two grayscale rows.
+ * @param cols   Number of valid columns (1–8); the others come out blank.
+ * @param out    8 column bytes.
+ */
+static inline void SBK_MAX72xxDither8x8(const uint8_t *gray, uint16_t stride, uint8_t cols, uint8_t *out)
+{
+    uint8_t rows[8];
+    for (uint8_t r = 0; r < 8; r++, gray += stride)
+    {
+        const uint8_t *thr = SBK_MAX72xxBayer8x8[r];
+        uint8_t bits = 0;
+        for (uint8_t c = 0; c < 8; c++)
+            bits = (bits << 1) | (c < cols && gray[c] >= thr[c]);
+        rows[r] = bits;
+    }
+
+    SBK_MAX72xxTranspose8x8(rows, out);
+}
+
+/**
+ * @brief Dither an 8-row grayscale image into the chain buffer (no SPI traffic).
+ *
+ * Pixels past the chain are dropped; call show() afterwards. The driver only sends the
+ * columns whose byte changed.
+ *
+ * @param driver Any SBK_MAX72xx driver.
+ * @param gray   Grayscale pixels, row-major (0 = off, 255 = on).
+ * @param width  Image width in pixels.
+ * @param stride Bytes between two grayscale rows (at least @p width).
+ * @param x      Chain-wide column receiving the image's first column.
+ */
+template <typename Driver>
+void SBK_MAX72xxDitherImage(Driver &driver, const uint8_t *gray, uint16_t width, uint16_t stride, uint16_t x = 0)
+{
+    const uint8_t devCols = driver.maxColumns();
+    const uint16_t chainCols = driver.devsNum() * devCols;
+
+    for (uint16_t i = 0; i < width && x + i < chainCols; i += 8)
+    {
+        uint8_t cols[8];
+        uint8_t n = (width - i < 8) ? width - i : 8;
+        SBK_MAX72xxDither8x8(gray + i, stride, n, cols);
+
+        for (uint8_t c = 0; c < n && x + i + c < chainCols; c++)
+            driver.setCol((x + i + c) / devCols, (x + i + c) % devCols, cols[c]);
+    }
+}
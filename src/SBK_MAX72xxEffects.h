@@ -0,0 +1,289 @@
+/**
+ * @file SBK_MAX72xxEffects.h
+ * @brief Bit-parallel effects (Life, rain, sparkle, fire, wipe, dissolve) on column bytes.
+ *
+ * Part of the SBK_MAX72xx Arduino Library.
+ * Effects run on a private copy of the chain's column bytes, four columns (32 pixels) per
+ * 32-bit word: a row shift is a masked word shift, a neighbour column is an unaligned word
+ * load, and random pixel masks come from ANDing random words. Game of Life counts the
+ * eight neighbours of 32 cells at once with bit-sliced adders, so a 32x8 step is eight
+ * word iterations of a few dozen bitwise operations each. flush() hands the result to the
+ * driver, which only sends the columns that changed.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ *
+ * @version 2.0.4
+ *
+ * @license MIT
+ *
+ * @copyright
+ * Copyright (c) 2025 Samuel Barabé
+ *
+ * Repository: https://github.com/sbarabe/SBK_MAX72xx
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * @class SBK_MAX72xxEffects
+ * @brief Whole-chain animated effects computed with SWAR bitwise operations.
+ *
+ * @tparam Driver Any SBK_MAX72xx driver class (SBK_MAX72xxHard, SBK_MAX72xxSoft, ...).
+ *
+ * Columns are numbered chain-wide: x = devIdx × 8 + colIdx. Rows follow the driver (row 0 = MSB).
+ * Each effect updates the effect buffer only; call flush() or show() to display it.
+ */
+template <typename Driver>
+class SBK_MAX72xxEffects
+{
+public:
+    /**
+     * @brief Construct an effects engine covering the whole chain of @p driver.
+     *
+     * @param driver Driver to draw into. Its devsNum() sets the width.
+     * @param seed   Random generator seed (any non-zero value).
+     */
+    explicit SBK_MAX72xxEffects(Driver &driver, uint32_t seed = 0x2545F491)
+        : _driver(driver),
+          _width(driver.devsNum() * driver.maxColumns()),
+          _rng(seed ? seed : 1)
+    {
+        // One padding word each side, so neighbour columns are plain unaligned loads
+        _cur = new uint8_t[_width + 2 * _pad]();
+        _next = new uint8_t[_width + 2 * _pad]();
+    }
+
+    ~SBK_MAX72xxEffects()
+    {
+        // Release the dynamically allocated memory
+        delete[] _cur;
+        delete[] _next;
+    }
+
+    /**
+     * @brief Effect width in columns (the whole chain).
+     */
+    uint16_t width() const { return _width; }
+
+    /**
+     * @brief Effect buffer: width() column bytes, drawable directly (e.g. to seed Life).
+     */
+    uint8_t *columns() { return _cur + _pad; }
+
+    /**
+     * @brief Load the driver's current buffer into the effect buffer.
+     */
+    void capture() { _driver.copyRegion(0, _width, columns()); }
+
+    /**
+     * @brief Blank the effect buffer.
+     */
+    void clear() { memset(columns(), 0, _width); }
+
+    /**
+     * @brief Re-seed the random generator (any non-zero value).
+     */
+    void seed(uint32_t seed) { _rng = seed ? seed : 1; }
+
+    /**
+     * @brief Advance Conway's Game of Life by one generation.
+     *
+     * @param wrap true to join the first and last columns (rows never wrap).
+     */
+    void lifeStep(bool wrap = true)
+    {
+        uint8_t *cols = columns();
+        _setEdges(wrap ? cols[_width - 1] : 0, wrap ? cols[0] : 0);
+
+        for (uint16_t i = 0; i < _width; i += 4)
+        {
+            uint32_t l = _load(cols + i - 1);
+            uint32_t c = _load(cols + i);
+            uint32_t r = _load(cols + i + 1);
+
+            // 3-bit neighbour count per cell; 8 neighbours wrap to 0, which is dead anyway
+            uint32_t s0 = 0, s1 = 0, s2 = 0;
+            _add(s0, s1, s2, _up(l));
+            _add(s0, s1, s2, l);
+            _add(s0, s1, s2, _down(l));
+            _add(s0, s1, s2, _up(c));
+            _add(s0, s1, s2, _down(c));
+            _add(s0, s1, s2, _up(r));
+            _add(s0, s1, s2, r);
+            _add(s0, s1, s2, _down(r));
+
+            // Alive next if count == 3, or count == 2 and alive now
+            _store(_next + _pad + i, ~s2 & s1 & (s0 | c));
+        }
+        _swap();
+    }
+
+    /**
+     * @brief Falling drops: every pixel moves down a row, new drops appear on row 0.
+     *
+     * @param density New drop probability per column is 1 / 2^density (1–8).
+     */
+    void rain(uint8_t density = 3)
+    {
+        uint8_t *cols = columns();
+        for (uint16_t i = 0; i < _width; i += 4)
+            _store(cols + i, _down(_load(cols + i)) | (_sparse(density) & 0x80808080));
+    }
+
+    /**
+     * @brief Random twinkling pixels (replaces the buffer each call).
+     *
+     * @param density Lit probability per pixel is 1 / 2^density (1–8).
+     */
+    void sparkle(uint8_t density = 3)
+    {
+        uint8_t *cols = columns();
+        for (uint16_t i = 0; i < _width; i += 4)
+            _store(cols + i, _sparse(density));
+    }
+
+    /**
+     * @brief Rising flames fed from the bottom row.
+     *
+     * Each pixel rises a row if it or both its side neighbours are lit, then cools
+     * out with probability 1 / 2^cooling.
+     *
+     * @param cooling Cooling rate (1–8); higher keeps taller flames.
+     */
+    void fire(uint8_t cooling = 2)
+    {
+        uint8_t *cols = columns();
+        _setEdges(0, 0);
+
+        for (uint16_t i = 0; i < _width; i += 4)
+        {
+            uint32_t l = _load(cols + i - 1);
+            uint32_t c = _load(cols + i);
+            uint32_t r = _load(cols + i + 1);
+
+            uint32_t risen = _up(c | (l & r)) & ~_sparse(cooling);
+            _store(_next + _pad + i, risen | (_random() & 0x01010101));
+        }
+        _swap();
+    }
+
+    /**
+     * @brief Fill columns 0 to @p pos - 1 with @p value (call with pos++ for a wipe).
+     */
+    void wipe(uint16_t pos, uint8_t value = 0xFF)
+    {
+        memset(columns(), value, pos < _width ? pos : _width);
+    }
+
+    /**
+     * @brief Move a random share of the pixels toward @p target.
+     *
+     * @param target  width() column bytes to reach, or nullptr to dissolve to blank.
+     * @param density Share of pixels copied per call is 1 / 2^density (1–8).
+     * @return true once the buffer equals the target.
+     */
+    bool dissolve(const uint8_t *target = nullptr, uint8_t density = 2)
+    {
+        uint8_t *cols = columns();
+        uint32_t diff = 0;
+
+        for (uint16_t i = 0; i < _width; i += 4)
+        {
+            uint32_t m = _sparse(density);
+            uint32_t t = target ? _load(target + i) : 0;
+            uint32_t w = (_load(cols + i) & ~m) | (t & m);
+            _store(cols + i, w);
+            diff |= w ^ t;
+        }
+        return diff == 0;
+    }
+
+    /**
+     * @brief Copy the effect buffer into the driver buffer (no SPI traffic).
+     */
+    void flush()
+    {
+        const uint8_t *cols = columns();
+        const uint8_t devCols = _driver.maxColumns();
+
+        for (uint16_t x = 0; x < _width; x++)
+            _driver.setCol(x / devCols, x % devCols, cols[x]);
+    }
+
+    /**
+     * @brief flush(), then push the driver buffer to the hardware.
+     */
+    void show()
+    {
+        flush();
+        _driver.show();
+    }
+
+private:
+    static constexpr uint8_t _pad = 4;
+
+    // memcpy keeps these alignment- and aliasing-safe, compilers emit a plain load/store
+    static uint32_t _load(const uint8_t *p)
+    {
+        uint32_t w;
+        memcpy(&w, p, sizeof(w));
+        return w;
+    }
+
+    static void _store(uint8_t *p, uint32_t w) { memcpy(p, &w, sizeof(w)); }
+
+    // Row shifts of four column bytes at once (row 0 = MSB)
+    static uint32_t _up(uint32_t w) { return (w << 1) & 0xFEFEFEFE; }
+    static uint32_t _down(uint32_t w) { return (w >> 1) & 0x7F7F7F7F; }
+
+    static void _add(uint32_t &s0, uint32_t &s1, uint32_t &s2, uint32_t n)
+    {
+        // Bit-sliced increment of 32 three-bit counters
+        uint32_t c0 = s0 & n;
+        s0 ^= n;
+        uint32_t c1 = s1 & c0;
+        s1 ^= c0;
+        s2 ^= c1;
+    }
+
+    uint32_t _random()
+    {
+        // xorshift32: a linear (LFSR-family) generator, one 32-bit mask per call
+        _rng ^= _rng << 13;
+        _rng ^= _rng >> 17;
+        _rng ^= _rng << 5;
+        return _rng;
+    }
+
+    uint32_t _sparse(uint8_t density)
+    {
+        // Each bit set with probability 1 / 2^density
+        uint32_t m = _random();
+        for (uint8_t i = 1; i < density; i++)
+            m &= _random();
+        return m;
+    }
+
+    void _setEdges(uint8_t left, uint8_t right)
+    {
+        _cur[_pad - 1] = left;
+        _cur[_pad + _width] = right;
+    }
+
+    void _swap()
+    {
+        uint8_t *t = _cur;
+        _cur = _next;
+        _next = t;
+    }
+
+    Driver &_driver;
+    const uint16_t _width; // Always a multiple of 8, so whole words
+    uint8_t *_cur = nullptr;
+    uint8_t *_next = nullptr;
+    uint32_t _rng;
+};
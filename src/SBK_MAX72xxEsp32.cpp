@@ -0,0 +1,617 @@
+/**
+ * @file SBK_MAX72xxEsp32.cpp
+ * @brief Implementation of the SBK_MAX72xxEsp32 class for controlling MAX7219/MAX7221 LED drivers.
+ *
+ * Part of the SBK_MAX72xx Arduino Library.
+ *
+ * This file contains the method implementations for managing multiple daisy-chained
+ * MAX7219/MAX7221 chips through the ESP-IDF SPI master driver (queued DMA transactions,
+ * hardware chip select). It compiles to nothing on non-ESP32 targets.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ *
+ * @version 2.0.4
+ *
+ * @license MIT
+ *
+ * Copyright (c) 2025 Samuel Barabé
+ */
+
+#if defined(ESP32)
+
+#include "SBK_MAX72xxEsp32.h"
+#include <esp_heap_caps.h>
+
+// MAX7219/MAX7221 Opcodes
+#define OP_NOOP 0x00
+#define OP_DIGIT0 0x01
+#define OP_DIGIT1 0x02
+#define OP_DIGIT2 0x03
+#define OP_DIGIT3 0x04
+#define OP_DIGIT4 0x05
+#define OP_DIGIT5 0x06
+#define OP_DIGIT6 0x07
+#define OP_DIGIT7 0x08
+#define OP_DECODEMODE 0x09
+#define OP_INTENSITY 0x0A
+#define OP_SCANLIMIT 0x0B
+#define OP_SHUTDOWN 0x0C
+#define OP_DISPLAYTEST 0x0F
+
+SBK_MAX72xxEsp32::SBK_MAX72xxEsp32(uint8_t dataPin,
+                                   uint8_t clkPin,
+                                   uint8_t csPin,
+                                   uint8_t devsNum,
+                                   spi_host_device_t host)
+    : _dataPin(dataPin),
+      _clkPin(clkPin),
+      _csPin(csPin),
+      _devsNum(constrain(devsNum, 1, 8)),
+      _host(host)
+{
+    _update = new uint8_t[_devsNum]();
+
+#ifdef SBK_MAX72XX_WIRE_ORDER_BUFFER
+    // The buffer holds the digit frames in wire order, so DMA can send it as is.
+    // Frames start on 32-bit boundaries: the IDF bounce-copies unaligned DMA buffers.
+    _buffer = static_cast<uint8_t *>(heap_caps_malloc(_defaultColBufferSize * _frameStride(), MALLOC_CAP_DMA));
+    for (uint8_t colIdx = 0; colIdx < _defaultColBufferSize; colIdx++)
+    {
+        uint8_t *frame = _buffer + colIdx * _frameStride();
+        for (uint8_t k = 0; k < _devsNum; k++)
+        {
+            *frame++ = OP_DIGIT0 + colIdx;
+            *frame++ = 0x00;
+        }
+    }
+#else
+    _buffer = new uint8_t[_devsNum * _defaultColBufferSize];
+    memset(_buffer, 0, _devsNum * _defaultColBufferSize);
+#endif
+}
+
+void SBK_MAX72xxEsp32::setSPIClock(uint32_t frequency)
+{
+    _spiClock = frequency;
+}
+
+void SBK_MAX72xxEsp32::end()
+{
+    waitIdle();
+
+    if (_transport.device)
+    {
+        spi_bus_remove_device(_transport.device);
+        _transport.device = nullptr;
+    }
+    if (_ownsBus)
+    {
+        spi_bus_free(_host);
+        _ownsBus = false;
+    }
+}
+
+SBK_MAX72xxEsp32::~SBK_MAX72xxEsp32()
+{
+    end();
+
+    // Release the dynamically allocated memory
+    heap_caps_free(_txBuffer);
+    heap_caps_free(_ctrlBuffer);
+#ifdef SBK_MAX72XX_WIRE_ORDER_BUFFER
+    heap_caps_free(_buffer);
+#else
+    delete[] _buffer;
+#endif
+    delete[] _update;
+}
+
+void SBK_MAX72xxEsp32::begin()
+{
+    // DMA can only read from internal, DMA-capable RAM
+    if (!_txBuffer)
+        _txBuffer = static_cast<uint8_t *>(heap_caps_malloc(maxColumns() * _frameStride(), MALLOC_CAP_DMA));
+    if (!_ctrlBuffer)
+        _ctrlBuffer = static_cast<uint8_t *>(heap_caps_malloc(_frameBytes(), MALLOC_CAP_DMA));
+    if (!_txBuffer || !_ctrlBuffer)
+        return;
+
+    if (!_transport.device)
+    {
+        spi_bus_config_t busConfig = {};
+        busConfig.mosi_io_num = _dataPin;
+        busConfig.miso_io_num = -1;
+        busConfig.sclk_io_num = _clkPin;
+        busConfig.quadwp_io_num = -1;
+        busConfig.quadhd_io_num = -1;
+        busConfig.max_transfer_sz = maxColumns() * _frameBytes();
+
+        esp_err_t err = spi_bus_initialize(_host, &busConfig, SPI_DMA_CH_AUTO);
+        if (err == ESP_OK)
+            _ownsBus = true;
+        else if (err != ESP_ERR_INVALID_STATE) // Already initialized: share the bus
+            return;
+
+        spi_device_interface_config_t devConfig = {};
+        devConfig.mode = 0;
+        devConfig.clock_speed_hz = _spiClock;
+        devConfig.spics_io_num = _csPin;       // CS rising edge latches each frame
+        devConfig.queue_size = maxColumns(); // A full refresh fits in the queue
+
+        if (spi_bus_add_device(_host, &devConfig, &_transport.device) != ESP_OK)
+        {
+            _transport.device = nullptr;
+            return;
+        }
+    }
+    delay(50); // small stabilization delay
+
+    for (uint8_t i = 0; i < _devsNum; ++i)
+    {
+        setShutdown(i, false);             // Wake up
+        setScanLimit(i, maxColumns() - 1); // Display all 8 digits
+        _spiTransfer(i, OP_DECODEMODE, 0); // No decode
+        testMode(i, false);                // Ensure test mode is OFF
+        clear(i);                          // Clear display
+        setBrightness(i, 8);               // Medium brightness
+    }
+}
+
+bool SBK_MAX72xxEsp32::busy()
+{
+    return _queue.busy();
+}
+
+void SBK_MAX72xxEsp32::waitIdle()
+{
+    _queue.waitIdle();
+}
+
+void SBK_MAX72xxEsp32::setShutdown(uint8_t devIdx, bool status)
+{
+    _spiTransfer(devIdx, OP_SHUTDOWN, status ? 0 : 1);
+}
+
+void SBK_MAX72xxEsp32::setScanLimit(uint8_t devIdx, uint8_t limit)
+{
+    _spiTransfer(devIdx, OP_SCANLIMIT, limit & 0x07);
+}
+
+void SBK_MAX72xxEsp32::setDecodeMode(uint8_t devIdx, uint8_t mask)
+{
+    _spiTransfer(devIdx, OP_DECODEMODE, mask);
+}
+
+void SBK_MAX72xxEsp32::setBrightness(uint8_t devIdx, uint8_t brightness)
+{
+    // constrain the brightness to a 4-bit number (0–15)
+    _spiTransfer(devIdx, OP_INTENSITY, brightness & 0x0F);
+}
+
+void SBK_MAX72xxEsp32::setBrightness(const uint8_t *levels)
+{
+    if (!levels)
+        return;
+
+    // One frame: every device latches its own intensity at once
+    _spiTransferAll(OP_INTENSITY, levels, 0x0F);
+}
+
+void SBK_MAX72xxEsp32::clear(uint8_t devIdx)
+{
+    if (devIdx >= _devsNum)
+        return;
+
+    for (uint8_t colIdx = 0; colIdx < maxColumns(); colIdx++)
+    {
+        _buffer[_colIndex(devIdx, colIdx)] = 0x00;
+        _spiTransfer(devIdx, OP_DIGIT0 + colIdx, 0x00);
+    }
+}
+
+void SBK_MAX72xxEsp32::clear()
+{
+    // Zero the whole chain with 8 chain-packed frames instead of 8 frames per device
+    for (uint8_t d = 0; d < _devsNum; d++)
+    {
+        for (uint8_t colIdx = 0; colIdx < maxColumns(); colIdx++)
+        {
+            _buffer[_colIndex(d, colIdx)] = 0x00;
+            _markCol(d, colIdx);
+        }
+    }
+
+    show();
+}
+
+void SBK_MAX72xxEsp32::setLed(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx, bool state)
+{
+    if (devIdx >= _devsNum || rowIdx >= maxRows(devIdx) || colIdx >= maxColumns())
+        return;
+
+    uint8_t &val = _buffer[_colIndex(devIdx, colIdx)];
+    uint8_t prior = val;
+
+    if (state)
+        val |= _bitMaskRow(devIdx, rowIdx);
+    else
+        val &= ~_bitMaskRow(devIdx, rowIdx);
+
+    if (val != prior)
+        _markCol(devIdx, colIdx);
+}
+
+bool SBK_MAX72xxEsp32::getLed(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx) const
+{
+    if (devIdx >= _devsNum || rowIdx >= maxRows(devIdx) || colIdx >= maxColumns())
+        return false;
+
+    return (_buffer[_colIndex(devIdx, colIdx)] & _bitMaskRow(devIdx, rowIdx)) != 0;
+}
+
+uint8_t SBK_MAX72xxEsp32::getCol(uint8_t devIdx, uint8_t colIdx) const
+{
+    if (devIdx >= _devsNum || colIdx >= maxColumns())
+        return 0;
+
+    return _buffer[_colIndex(devIdx, colIdx)];
+}
+
+void SBK_MAX72xxEsp32::getFrame(uint8_t devIdx, uint8_t *out, bool rowMajor) const
+{
+    if (devIdx >= _devsNum || !out)
+        return;
+
+    for (uint8_t colIdx = 0; colIdx < maxColumns(); colIdx++)
+        out[colIdx] = _buffer[_colIndex(devIdx, colIdx)];
+
+    if (rowMajor)
+        SBK_MAX72xxTranspose8x8(out, out);
+}
+
+uint16_t SBK_MAX72xxEsp32::copyRegion(uint16_t x, uint16_t width, uint8_t *out, bool rowMajor) const
+{
+    const uint16_t colsNum = _devsNum * maxColumns();
+    if (!out || x >= colsNum)
+        return 0;
+
+    if (width > colsNum - x)
+        width = colsNum - x;
+
+    if (!rowMajor)
+    {
+        for (uint16_t i = 0; i < width; i++, x++)
+            out[i] = _buffer[_colIndex(x / maxColumns(), x % maxColumns())];
+        return width;
+    }
+
+    // Row-major: transpose one 8-column block at a time into 8 rows of stride bytes
+    const uint16_t stride = (width + 7) / 8;
+    for (uint16_t block = 0; block < stride; block++)
+    {
+        uint8_t cols[8] = {0};
+        for (uint8_t i = 0; i < 8 && block * 8 + i < width; i++)
+        {
+            uint16_t col = x + block * 8 + i;
+            cols[i] = _buffer[_colIndex(col / maxColumns(), col % maxColumns())];
+        }
+
+        SBK_MAX72xxTranspose8x8(cols, cols);
+        for (uint8_t rowIdx = 0; rowIdx < 8; rowIdx++)
+            out[rowIdx * stride + block] = cols[rowIdx];
+    }
+    return width;
+}
+
+void SBK_MAX72xxEsp32::setCol(uint8_t devIdx, uint8_t colIdx, uint8_t value)
+{
+    if (devIdx >= _devsNum || colIdx >= maxColumns())
+        return;
+
+    if (_buffer[_colIndex(devIdx, colIdx)] != value)
+    {
+        _buffer[_colIndex(devIdx, colIdx)] = value;
+        _markCol(devIdx, colIdx); // Mark device and digit frame for update
+    }
+}
+
+void SBK_MAX72xxEsp32::setLedFast(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx, bool state)
+{
+    SBK_MAX72XX_ASSERT(devIdx < _devsNum && rowIdx < maxRows(devIdx) && colIdx < maxColumns());
+
+    uint8_t &val = _buffer[_colIndex(devIdx, colIdx)];
+    uint8_t next = state ? (val | SBK_MAX72xxRowMask[rowIdx]) : (val & ~SBK_MAX72xxRowMask[rowIdx]);
+
+    if (next != val)
+    {
+        val = next;
+        _markCol(devIdx, colIdx);
+    }
+}
+
+void SBK_MAX72xxEsp32::togglePixel(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx)
+{
+    SBK_MAX72XX_ASSERT(devIdx < _devsNum && rowIdx < maxRows(devIdx) && colIdx < maxColumns());
+
+    _buffer[_colIndex(devIdx, colIdx)] ^= SBK_MAX72xxRowMask[rowIdx];
+    _markCol(devIdx, colIdx);
+}
+
+void SBK_MAX72xxEsp32::writePixelSpan(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx, uint8_t len, bool state)
+{
+    SBK_MAX72XX_ASSERT(devIdx < _devsNum && rowIdx < maxRows(devIdx) && colIdx + len <= maxColumns());
+
+    const uint8_t mask = SBK_MAX72xxRowMask[rowIdx];
+    for (uint8_t end = colIdx + len; colIdx < end; colIdx++)
+    {
+        uint8_t &val = _buffer[_colIndex(devIdx, colIdx)];
+        uint8_t next = state ? (val | mask) : (val & ~mask);
+
+        if (next != val)
+        {
+            val = next;
+            _markCol(devIdx, colIdx);
+        }
+    }
+}
+
+void SBK_MAX72xxEsp32::toggleLed(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx)
+{
+    if (devIdx >= _devsNum || rowIdx >= maxRows(devIdx) || colIdx >= maxColumns())
+        return;
+
+    _buffer[_colIndex(devIdx, colIdx)] ^= _bitMaskRow(devIdx, rowIdx);
+    _markCol(devIdx, colIdx);
+}
+
+void SBK_MAX72xxEsp32::invert(uint8_t devIdx)
+{
+    if (devIdx >= _devsNum)
+        return;
+
+    for (uint8_t colIdx = 0; colIdx < maxColumns(); colIdx++)
+    {
+        _buffer[_colIndex(devIdx, colIdx)] ^= 0xFF;
+        _markCol(devIdx, colIdx);
+    }
+}
+
+void SBK_MAX72xxEsp32::invertAll()
+{
+#ifdef SBK_MAX72XX_WIRE_ORDER_BUFFER
+    // Flip the data bytes of the digit frames, leave the opcodes and the padding alone
+    for (uint8_t colIdx = 0; colIdx < _defaultColBufferSize; colIdx++)
+        SBK_MAX72xxXorPattern(_buffer + colIdx * _frameStride(), _frameBytes(), 0x00, 0xFF);
+#else
+    SBK_MAX72xxXorPattern(_buffer, _devsNum * _defaultColBufferSize, 0xFF, 0xFF);
+#endif
+    _dirtyCols = 0xFF;
+    for (uint8_t devIdx = 0; devIdx < _devsNum; devIdx++)
+        _update[devIdx] = 0xFF;
+}
+
+void SBK_MAX72xxEsp32::writeMasked(uint8_t devIdx, uint8_t colIdx, uint8_t mask, uint8_t value)
+{
+    if (devIdx >= _devsNum || colIdx >= maxColumns())
+        return;
+
+    uint8_t &val = _buffer[_colIndex(devIdx, colIdx)];
+    uint8_t next = (val & ~mask) | (value & mask);
+
+    if (next != val)
+    {
+        val = next;
+        _markCol(devIdx, colIdx);
+    }
+}
+
+void SBK_MAX72xxEsp32::show()
+{
+#ifdef SBK_MAX72XX_WIRE_ORDER_BUFFER
+    if (!_transport.device || !_dirtyCols)
+        return;
+
+    // Zero-copy: DMA reads the changed digit frames straight from the display buffer
+    // (each one 32-bit aligned, so the IDF does not bounce it through a copy).
+    // A pixel drawn while its frame is in flight is flagged again and resent next show();
+    // the queue only reuses a descriptor once the IDF has returned it.
+    uint8_t failed = 0;
+    for (uint8_t colIdx = 0; colIdx < maxColumns(); colIdx++)
+    {
+        if ((_dirtyCols & (1 << colIdx)) && !_queueFrame(_buffer + colIdx * _frameStride()))
+            failed |= 1 << colIdx;
+    }
+#else
+    if (!_transport.device || !_anyUpdate())
+        return;
+
+    waitIdle(); // _txBuffer may still be read by DMA
+
+    uint8_t failed = 0;
+    for (uint8_t colIdx = 0; colIdx < maxColumns(); colIdx++)
+    {
+        if (!_queueColToUpdatedDevices(colIdx))
+            failed |= 1 << colIdx;
+    }
+#endif
+
+    // Digits the IDF refused stay dirty and go out with the next show()
+    _dirtyCols = failed;
+    for (uint8_t devIdx = 0; devIdx < _devsNum; devIdx++)
+        _update[devIdx] &= failed;
+}
+
+void SBK_MAX72xxEsp32::show(uint8_t devIdx)
+{
+    if (!_transport.device || devIdx >= _devsNum || !_update[devIdx])
+        return;
+
+    waitIdle(); // _txBuffer may still be read by DMA
+
+    uint8_t failed = 0;
+    for (uint8_t colIdx = 0; colIdx < maxColumns(); colIdx++)
+    {
+        if (!_queueColToAllDevices(devIdx, colIdx, _buffer[_colIndex(devIdx, colIdx)]))
+            failed |= 1 << colIdx;
+    }
+    _update[devIdx] = failed; // Refused digits stay dirty
+
+    // Keep only the digits another device still waits for
+    _dirtyCols = 0;
+    for (uint8_t i = 0; i < _devsNum; i++)
+        _dirtyCols |= _update[i];
+}
+
+void SBK_MAX72xxEsp32::testMode(uint8_t devIdx, bool enable)
+{
+    if (devIdx >= _devsNum)
+        return;
+
+    // MAX7219 test mode uses register 0x0F
+    // value 1 = test ON (all segments), 0 = test OFF
+    _spiTransfer(devIdx, OP_DISPLAYTEST, enable ? 1 : 0);
+}
+
+void SBK_MAX72xxEsp32::_spiTransfer(uint8_t targetDevice, uint8_t opcode, uint8_t data)
+{
+    if (targetDevice >= _devsNum || !_transport.device)
+        return; // Prevent invalid access
+
+    _queue.waitIdle(); // Keep register writes ordered after queued frames
+
+    uint8_t *frame = _ctrlBuffer;
+    for (int8_t i = _devsNum - 1; i >= 0; i--)
+    {
+        bool target = (i == static_cast<int8_t>(targetDevice));
+        *frame++ = target ? opcode : OP_NOOP;
+        *frame++ = target ? data : 0;
+    }
+
+    _queue.transmit(_ctrlBuffer, _frameBytes());
+
+    if (_capture)
+    {
+        _capture->beginFrame();
+        for (uint8_t i = 0; i < _frameBytes(); i++)
+            _capture->push(_ctrlBuffer[i]);
+        _capture->endFrame();
+    }
+}
+
+void SBK_MAX72xxEsp32::_spiTransferAll(uint8_t opcode, const uint8_t *data, uint8_t mask)
+{
+    if (!_transport.device)
+        return; // Prevent invalid access
+
+    _queue.waitIdle(); // Keep register writes ordered after queued frames
+
+    uint8_t *frame = _ctrlBuffer;
+    for (int8_t i = _devsNum - 1; i >= 0; i--)
+    {
+        *frame++ = opcode;
+        *frame++ = data[i] & mask;
+    }
+
+    _queue.transmit(_ctrlBuffer, _frameBytes());
+
+    if (_capture)
+    {
+        _capture->beginFrame();
+        for (uint8_t i = 0; i < _frameBytes(); i++)
+            _capture->push(_ctrlBuffer[i]);
+        _capture->endFrame();
+    }
+}
+
+bool SBK_MAX72xxEsp32::_queueColToAllDevices(uint8_t targetDevice, uint8_t colIdx, uint8_t data)
+{
+    if (targetDevice >= _devsNum || colIdx >= maxColumns())
+        return false;
+
+    uint8_t *frame = _txBuffer + colIdx * _frameStride();
+    uint8_t *out = frame;
+    for (int8_t i = _devsNum - 1; i >= 0; i--)
+    {
+        bool target = (i == static_cast<int8_t>(targetDevice));
+        *out++ = target ? (OP_DIGIT0 + colIdx) : OP_NOOP;
+        *out++ = target ? data : 0;
+    }
+
+    return _queueFrame(frame);
+}
+
+bool SBK_MAX72xxEsp32::_queueColToUpdatedDevices(uint8_t colIdx)
+{
+    if (colIdx >= maxColumns())
+        return false;
+
+    // One frame refreshes this digit on every updated device; unchanged devices get a NOOP
+    uint8_t *frame = _txBuffer + colIdx * _frameStride();
+    uint8_t *out = frame;
+    for (int8_t i = _devsNum - 1; i >= 0; i--)
+    {
+        if (_update[i])
+        {
+            *out++ = OP_DIGIT0 + colIdx;
+            *out++ = _buffer[_colIndex(i, colIdx)];
+        }
+        else
+        {
+            *out++ = OP_NOOP;
+            *out++ = 0;
+        }
+    }
+
+    return _queueFrame(frame);
+}
+
+bool SBK_MAX72xxEsp32::_queueFrame(uint8_t *frame)
+{
+    // Reuses a descriptor only once the IDF has returned it
+    if (!_queue.queue(frame, _frameBytes()))
+        return false; // Never went on the wire: nothing to capture
+
+    if (_capture)
+    {
+        _capture->beginFrame();
+        for (uint8_t i = 0; i < _frameBytes(); i++)
+            _capture->push(frame[i]);
+        _capture->endFrame();
+    }
+    return true;
+}
+
+bool SBK_MAX72xxEsp32::_anyUpdate() const
+{
+    for (uint8_t devIdx = 0; devIdx < _devsNum; devIdx++)
+    {
+        if (_update[devIdx])
+            return true;
+    }
+    return false;
+}
+
+inline void SBK_MAX72xxEsp32::_markCol(uint8_t devIdx, uint8_t colIdx)
+{
+    _dirtyCols |= 1 << colIdx;
+    _update[devIdx] |= 1 << colIdx;
+}
+
+inline uint8_t SBK_MAX72xxEsp32::_bitMaskRow(uint8_t devIdx, uint8_t rowIdx) const
+{
+    (void)devIdx;
+    return SBK_MAX72xxRowMask[rowIdx]; // Same as 1 << (maxRows() - 1 - rowIdx), without the shift loop on AVR
+}
+
+inline uint8_t SBK_MAX72xxEsp32::_colIndex(uint8_t devIdx, uint8_t colIdx) const
+{
+#ifdef SBK_MAX72XX_WIRE_ORDER_BUFFER
+    // Data byte of device devIdx inside digit frame colIdx (wire order: device N-1 first)
+    return colIdx * _frameStride() + (_devsNum - 1 - devIdx) * 2 + 1;
+#else
+    return devIdx * _defaultColBufferSize + colIdx;
+#endif
+}
+
+#endif // ESP32
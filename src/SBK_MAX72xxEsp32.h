@@ -0,0 +1,462 @@
+/**
+ * @file SBK_MAX72xxEsp32.h
+ * @brief ESP32 native SPI master driver for controlling multiple MAX7219/MAX7221 LED matrix chips.
+ *
+ * Part of the SBK_MAX72xx Arduino Library.
+ * Bypasses the Arduino SPI wrapper and talks to the ESP-IDF SPI master driver directly:
+ * DMA-capable frame buffers, hardware chip select and queued transactions, so a whole
+ * chain refresh is handed to the peripheral at once and completes while the sketch runs.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ *
+ * @version 2.0.4
+ *
+ * @license MIT
+ *
+ * @copyright
+ * Copyright (c) 2025 Samuel Barabé
+ *
+ * Repository: https://github.com/sbarabe/SBK_MAX72xx
+ */
+
+#pragma once
+
+#define SBK_MAX72xx_IS_DEFINED
+
+#if !defined(ESP32)
+#error "SBK_MAX72xxEsp32 requires an ESP32 target. Use SBK_MAX72xxHard or SBK_MAX72xxSoft instead."
+#endif
+
+#include <Arduino.h>
+#include <driver/spi_master.h>
+#include "SBK_MAX72xxCapture.h"
+#include "SBK_MAX72xxFast.h"
+#include "SBK_MAX72xxSpiQueue.h"
+
+/**
+ * @class SBK_MAX72xxEsp32Transport
+ * @brief ESP-IDF SPI master calls behind the SBK_MAX72xxSpiQueue transport interface.
+ */
+class SBK_MAX72xxEsp32Transport
+{
+public:
+    typedef spi_transaction_t Descriptor;
+
+    spi_device_handle_t device = nullptr; ///< Set once the chain is added to the bus
+
+    bool queue(Descriptor &trans, const uint8_t *data, uint16_t len)
+    {
+        trans = spi_transaction_t();
+        trans.length = len * 8; // In bits
+        trans.tx_buffer = data;
+        return spi_device_queue_trans(device, &trans, portMAX_DELAY) == ESP_OK;
+    }
+
+    Descriptor *result(bool wait)
+    {
+        spi_transaction_t *done = nullptr;
+        if (spi_device_get_trans_result(device, &done, wait ? portMAX_DELAY : 0) != ESP_OK)
+            return nullptr;
+        return done;
+    }
+
+    void transmit(const uint8_t *data, uint16_t len)
+    {
+        spi_transaction_t trans = {};
+        trans.length = len * 8; // In bits
+        trans.tx_buffer = data;
+        spi_device_transmit(device, &trans);
+    }
+};
+
+/**
+ * @class SBK_MAX72xxEsp32
+ * @brief Controls multiple MAX7219/MAX7221 LED drivers via the ESP32 SPI master peripheral.
+ *
+ * show() builds one frame per digit register in a DMA-capable buffer and queues all of
+ * them without waiting; the CPU is free while the chain refreshes. Register writes
+ * (brightness, shutdown...) and the next show() wait for queued frames to finish first.
+ */
+class SBK_MAX72xxEsp32
+{
+public:
+    /**
+     * @brief Construct a new ESP32 SPI master SBK_MAX72xxEsp32 driver instance.
+     *
+     * @param dataPin      Data output pin (MOSI -> DIN).
+     * @param clkPin       Clock pin (SCLK -> CLK).
+     * @param csPin        Chip Select pin (CS), driven by the SPI peripheral.
+     * @param devsNum      Number of daisy-chained MAX72xx devices. Default is 1.
+     * @param host         SPI peripheral to use (SPI2_HOST or SPI3_HOST). Default is SPI2_HOST.
+     *
+     * Initializes internal display buffer for each device in the chain.
+     * Each device reserves 8 bytes — one for each digit line (DIG0–DIG7), representing columns (cathode outputs).
+     * @note Each byte in the buffer holds segment (SEG0–SEG7) values for one column.
+     * @note The bus is shared: if @p host is already initialized (e.g. by another driver
+     *       on the same pins), the chain is simply added as a new device on it.
+     */
+    SBK_MAX72xxEsp32(uint8_t dataPin, uint8_t clkPin, uint8_t csPin, uint8_t devsNum = 1,
+                     spi_host_device_t host = SPI2_HOST);
+
+    /**
+     * @brief Set SPI clock speed. Call before begin().
+     * @param frequency Frequency in Hz (e.g., 1000000 for 1 MHz, MAX7219 max is 10 MHz).
+     */
+    void setSPIClock(uint32_t frequency);
+
+    /**
+     * @brief Wait for queued frames, then remove the chain from the SPI bus.
+     */
+    void end();
+
+    /**
+     * @brief Check whether frames queued by show() are still being sent.
+     *
+     * @return true while the SPI peripheral is still sending the last refresh.
+     */
+    bool busy();
+
+    /**
+     * @brief Block until every queued frame has been sent.
+     */
+    void waitIdle();
+
+    ~SBK_MAX72xxEsp32(); // Destructor
+
+    /**
+     * @brief Returns the number of addressable row lines (anode outputs = SEGx).
+     *
+     * @param devIdx Index of the target device (0-based in daisy chain).
+     *               This parameter is ignored for MAX7219/7221 chips,
+     *               but included for API compatibility with SBK_BarDrive.
+     *
+     * For MAX7219/7221 drivers, this value is always 8, since each column (DIGx)
+     * can display up to 8 vertical segments connected to SEG0–SEG7 (anode lines).
+     *
+     * @return Number of row lines (SEGx/anodes), always 8 for MAX72xx devices.
+     */
+    uint8_t maxRows(uint8_t devIdx = 0) const
+    {
+        (void)devIdx;
+        return _defaultRowBufferSize;
+    }
+
+    /**
+     * @brief Returns the number of addressable columns (cathode outputs = DIGx).
+     *
+     * This is a fixed value of 8 for MAX7219/7221, since each digit line (DIG0–DIG7) selects one column (cathode).
+     * Each DIGx line maps to one 8-bit buffer entry representing the vertical SEGx lines.
+     *
+     * @return Number of columns (DIGx = cathode outputs), always 8.
+     */
+    uint8_t maxColumns() const { return _defaultColBufferSize; }
+
+    /**
+     * @brief Returns the total number of addressable LED segments for this device.
+     *
+     * @param devIdx Index of the target device (0-based in daisy chain).
+     *               This parameter is ignored for MAX7219/7221 chips,
+     *               but is included for API compatibility with SBK_BarDrive.
+     *
+     * This value is computed as:
+     * `maxRows(devIdx) × maxColumns()`
+     * For MAX7219/7221, this is always 8 × 8 = 64 segments per device.
+     *
+     * @return Total number of addressable LED segments (pixels) for this device.
+     */
+    uint8_t maxSegments(uint8_t devIdx = 0) const { return maxRows(devIdx) * maxColumns(); }
+
+    /**
+     * @brief Initialize the SPI bus, DMA buffers and all MAX72xx chips.
+     */
+    void begin();
+
+    /**
+     * @brief Enable or disable shutdown mode on a specific device.
+     *
+     * @param devIdx Index of the target device.
+     * @param status false = shutdown, true = normal operation
+     */
+    void setShutdown(uint8_t devIdx, bool status);
+
+    /**
+     * @brief Set the scan limit (number of active digits) for a specific device.
+     *
+     * @param devIdx Target device index.
+     * @param limit  Value from 0 to 7.
+     */
+    void setScanLimit(uint8_t devIdx, uint8_t limit);
+
+    /**
+     * @brief Set the BCD Code-B decode mode of a specific device.
+     *
+     * @param devIdx Target device index.
+     * @param mask   One bit per digit (bit n = DIGn): 1 = Code-B, 0 = no decode (default).
+     *
+     * Digits in Code-B mode show the low nibble of their buffer byte as 0–9, '-', 'E',
+     * 'H', 'L', 'P' or blank, and bit 7 as the decimal point.
+     */
+    void setDecodeMode(uint8_t devIdx, uint8_t mask);
+
+    /**
+     * @brief Set display brightness for a specific device.
+     *
+     * @param devIdx Target device index.
+     * @param brightness Value from 0 (min) to 15 (max).
+     */
+    void setBrightness(uint8_t devIdx, uint8_t brightness);
+
+    /**
+     * @brief Set the brightness of every device with a single chain frame.
+     *
+     * @param levels One value per device, 0 (min) to 15 (max), device 0 first.
+     */
+    void setBrightness(const uint8_t *levels);
+
+    /**
+     * @brief Return the number of actives driver devices.
+     *
+     * @return number of actives driver devices.
+     */
+    uint8_t devsNum() const { return _devsNum; }
+
+    /**
+     * @brief Clear display buffer and hardware for one device.
+     *
+     * @param devIdx Target device index.
+     */
+    void clear(uint8_t devIdx);
+
+    /**
+     * @brief Clear display buffers and hardware for all devices.
+     *
+     * The whole chain is cleared with 8 chain-wide frames (see show()).
+     */
+    void clear();
+
+    /**
+     * @brief Set the state of a specific LED in the device’s internal matrix buffer.
+     *
+     * @param devIdx    Index of the target device (0-based in daisy chain).
+     * @param rowIdx    Logical rowIdx index (0 to maxRows(_devIdx) - 1) — vertical position (anode).
+     * @param colIdx    Logical column index (0 to maxColumns() - 1) — horizontal position (cathode).
+     * @param state     true = LED ON, false = LED OFF.
+     *
+     * @note The coordinate system follows a standard [row, col] layout.
+     *       For MAX72xx drivers:
+     *         - row corresponds to SEGx (segment outputs, V+ source = anode)
+     *         - col corresponds to DIGx (digit selectors, GND sink = cathode)
+     *
+     * This function updates the internal buffer; call show() to apply changes to hardware.
+     */
+    void setLed(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx, bool state);
+
+    /**
+     * @brief Get the state of a specific LED in the device’s internal matrix buffer.
+     *
+     * This function reads the last known state of a given LED at the specified row and column
+     * on a target device. It does not access the physical display hardware, but instead reads from
+     * the internal RAM buffer used for batching updates.
+     *
+     * @note This function may not reflect real-time display contents unless `show()` has been called
+     * after `setLed()`. For animations or state-dependent logic, ensure consistency by calling `show()` regularly.
+     *
+     * @param devIdx Index of the target device (0-based).
+     * @param rowIdx Row index (0–7).
+     * @param colIdx Column index (0–7).
+     * @return true if the LED is currently set ON in the buffer, false if OFF or invalid.
+     *
+     * @note The coordinate system follows a standard [row, col] layout.
+     *       For MAX72xx drivers:
+     *         - row corresponds to SEGx (segment outputs, V+ source = anode)
+     *         - col corresponds to DIGx (digit selectors, GND sink = cathode)
+     */
+    bool getLed(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx) const;
+
+    /**
+     * @brief Read one column byte from the buffer.
+     *
+     * @param devIdx Index of the target device.
+     * @param colIdx Column number (0 to 7).
+     * @return Column byte (row 0 = MSB), 0 if out of range.
+     */
+    uint8_t getCol(uint8_t devIdx, uint8_t colIdx) const;
+
+    /**
+     * @brief Copy the 8 column bytes of one device from the buffer.
+     *
+     * @param devIdx   Index of the target device.
+     * @param out      Destination, 8 bytes.
+     * @param rowMajor false = column bytes as setCol() takes them; true = 8 row bytes
+     *                 (row 0 first, column 0 = MSB), via an 8x8 bit transpose.
+     */
+    void getFrame(uint8_t devIdx, uint8_t *out, bool rowMajor = false) const;
+
+    /**
+     * @brief Snapshot a run of columns across the chain.
+     *
+     * Columns are numbered chain-wide: x = devIdx × 8 + colIdx.
+     *
+     * @param x        First column.
+     * @param width    Number of columns, clipped to the end of the chain.
+     * @param out      Destination: @p width column bytes, or with @p rowMajor 8 rows of
+     *                 (width + 7) / 8 bytes each (leftmost column = MSB of the first byte).
+     * @param rowMajor Transpose to row-major as in getFrame().
+     * @return Number of columns copied.
+     */
+    uint16_t copyRegion(uint16_t x, uint16_t width, uint8_t *out, bool rowMajor = false) const;
+
+    /**
+     * @brief Set the entire col value for a specific device (buffer only).
+     *
+     * @param devIdx    Index of the target device.
+     * @param colIdx    Column number (0 to 7).
+     * @param value     8-bit value for the row.
+     */
+    void setCol(uint8_t devIdx, uint8_t colIdx, uint8_t value);
+
+    /**
+     * @brief Unchecked setLed() for inner drawing loops that already clip their coordinates.
+     *
+     * Same effect as setLed() without the three bounds checks. Out-of-range arguments are
+     * undefined behavior; build with `SBK_MAX72XX_DEBUG` to turn them into assertions.
+     */
+    void setLedFast(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx, bool state);
+
+    /**
+     * @brief Unchecked pixel toggle (see setLedFast()).
+     */
+    void togglePixel(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx);
+
+    /**
+     * @brief Unchecked horizontal run: set @p len pixels of row @p rowIdx from column @p colIdx.
+     *
+     * The span must stay on one device (colIdx + len <= maxColumns()). See setLedFast().
+     */
+    void writePixelSpan(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx, uint8_t len, bool state);
+
+    /**
+     * @brief Toggle one LED in the buffer.
+     *
+     * @param devIdx Index of the target device.
+     * @param rowIdx Row index (0–7).
+     * @param colIdx Column index (0–7).
+     */
+    void toggleLed(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx);
+
+    /**
+     * @brief Invert every LED of one device (buffer only).
+     *
+     * @param devIdx Index of the target device.
+     */
+    void invert(uint8_t devIdx);
+
+    /**
+     * @brief Invert every LED of the chain (buffer only), a 32-bit word at a time.
+     */
+    void invertAll();
+
+    /**
+     * @brief Write only the masked bits of a column (buffer only).
+     *
+     * @param devIdx Index of the target device.
+     * @param colIdx Column number (0 to 7).
+     * @param mask   Bits to change (row 0 = MSB).
+     * @param value  New values for the bits set in @p mask; other bits are ignored.
+     */
+    void writeMasked(uint8_t devIdx, uint8_t colIdx, uint8_t mask, uint8_t value);
+
+    /**
+     * @brief Push the internal display buffer to all connected devices.
+     *
+     * This flushes all buffered LED states to the physical hardware for every device
+     * managed by this driver instance. Use this after making multiple `setLed()` calls
+     * to apply the changes to the display.
+     *
+     * Typically used in split-device or multi-bar meter setups.
+     *
+     * All updated devices are refreshed together: each of the 8 digit registers is sent
+     * in a single chain-wide frame, with NOOPs for devices that did not change.
+     * The frames are queued to the SPI peripheral and this call returns immediately;
+     * use busy() or waitIdle() if the sketch needs to know when they are out.
+     *
+     * Built with `SBK_MAX72XX_WIRE_ORDER_BUFFER`, only the digits that changed are queued,
+     * and DMA reads them straight from the display buffer without any copy (each digit
+     * frame is padded to a 32-bit boundary so the IDF never bounce-copies it).
+     */
+    void show();
+
+    /**
+     * @brief Push the internal display buffer to a specific device.
+     *
+     * @param devIdx Index of the target device (0-based in the daisy chain).
+     *
+     * Only the specified device's display will be updated. Useful for optimized
+     * partial updates when only one device has changed.
+     *
+     * @note The driver must track changes correctly for this to be meaningful.
+     */
+    void show(uint8_t devIdx);
+
+     /**
+     * @brief Enable/disable display-test mode on all devices.
+     */
+    void testMode(bool enable)
+    {
+        for (uint8_t i = 0; i < _devsNum; i++)
+            testMode(i, enable);
+    }
+
+    /**
+     * @brief Enable or disable the MAX72xx display test mode.
+     *
+     * @param devIdx Target device index (0-based)
+     * @param enable true = enable test mode (all LEDs ON), false = disable
+     */
+    void testMode(uint8_t devIdx, bool enable);
+
+    /**
+     * @brief Record every SPI frame sent by this driver.
+     *
+     * @param capture Capture to feed (see SBK_MAX72xxCapture), or nullptr to stop recording.
+     *
+     * The capture must outlive the driver or be detached before it is destroyed.
+     */
+    void setCapture(SBK_MAX72xxCapture *capture) { _capture = capture; }
+
+private:
+    void _spiTransfer(uint8_t targetDevice, uint8_t opcode, uint8_t data);
+    void _spiTransferAll(uint8_t opcode, const uint8_t *data, uint8_t mask = 0xFF);
+    bool _queueColToAllDevices(uint8_t targetDevice, uint8_t colIdx, uint8_t data);
+    bool _queueColToUpdatedDevices(uint8_t colIdx);
+    bool _queueFrame(uint8_t *frame);
+    bool _anyUpdate() const;
+    inline void _markCol(uint8_t devIdx, uint8_t colIdx);
+    inline uint8_t _bitMaskRow(uint8_t devIdx, uint8_t rowIdx) const;
+    inline uint8_t _colIndex(uint8_t devIdx, uint8_t colIdx) const;
+    inline uint8_t _frameBytes() const { return _devsNum * 2; }
+    inline uint8_t _frameStride() const { return (_frameBytes() + 3) & ~3; } // Keeps every frame 32-bit aligned for DMA
+
+    const uint8_t _dataPin;
+    const uint8_t _clkPin;
+    const uint8_t _csPin;
+    const uint8_t _devsNum = 1;
+    const spi_host_device_t _host;
+
+    static constexpr uint8_t _defaultRowBufferSize = 8;
+    static constexpr uint8_t _defaultColBufferSize = 8;
+    uint8_t *_buffer; // Internal display buffer (DMA-capable wire-order frames with SBK_MAX72XX_WIRE_ORDER_BUFFER)
+    uint8_t *_update; // Per device: bit c set when its digit c changed since it was last sent
+    uint8_t _dirtyCols = 0; // Bit c set when digit c changed since the last show()
+
+    SBK_MAX72xxCapture *_capture = nullptr; // Optional SPI frame recorder
+
+    SBK_MAX72xxEsp32Transport _transport; // IDF device handle and calls
+    SBK_MAX72xxSpiQueue<SBK_MAX72xxEsp32Transport, _defaultColBufferSize> _queue{_transport}; // A full refresh fits
+    bool _ownsBus = false;          // true if begin() initialized the bus
+    uint8_t *_txBuffer = nullptr;   // DMA-capable, one frame per digit register
+    uint8_t *_ctrlBuffer = nullptr; // DMA-capable, single register frame
+
+    uint32_t _spiClock = 1000000; // Default 1 MHz
+};
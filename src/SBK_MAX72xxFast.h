@@ -0,0 +1,145 @@
+/**
+ * @file SBK_MAX72xxFast.h
+ * @brief Shared helpers for the MAX72xx drivers' unchecked fast pixel API and graphics layers.
+ *
+ * Part of the SBK_MAX72xx Arduino Library.
+ * Holds the row bit-mask lookup table used by every driver (no variable shift on AVR,
+ * which has no barrel shifter) and the assertion macro that replaces bounds checks in
+ * setLedFast(), togglePixel() and writePixelSpan(), plus the word-wide XOR used by invertAll()
+ * and the 8x8 bit transpose used for row-major readback. Also reads flash (PROGMEM) data
+ * for the graphics layers on every target.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ *
+ * @version 2.0.4
+ *
+ * @license MIT
+ *
+ * @copyright
+ * Copyright (c) 2025 Samuel Barabé
+ *
+ * Repository: https://github.com/sbarabe/SBK_MAX72xx
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+#if defined(__AVR__)
+#include <avr/pgmspace.h>
+#endif
+#ifndef PROGMEM
+#define PROGMEM // Flash and RAM share the address space off AVR (and on Linux builds)
+#endif
+
+/**
+ * @brief Bit of row rowIdx (SEGx) in a column byte: row 0 is the MSB.
+ */
+static constexpr uint8_t SBK_MAX72xxRowMask[8] = {0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01};
+
+/**
+ * @brief Checks arguments of the unchecked fast API.
+ *
+ * Compiled out unless the library is built with `SBK_MAX72XX_DEBUG` defined, in which case
+ * a failed check calls assert() (on AVR, define `__ASSERT_USE_STDERR` to get a message).
+ */
+#ifdef SBK_MAX72XX_DEBUG
+#include <assert.h>
+#define SBK_MAX72XX_ASSERT(cond) assert(cond)
+#else
+#define SBK_MAX72XX_ASSERT(cond) ((void)0)
+#endif
+
+/**
+ * @brief XOR @p len bytes with a repeating two-byte pattern, one 32-bit word at a time.
+ *
+ * @param bytes Buffer to modify.
+ * @param len   Number of bytes.
+ * @param even  XOR value for bytes at even offsets (opcodes in a wire-order frame).
+ * @param odd   XOR value for bytes at odd offsets (data in a wire-order frame).
+ */
+static inline void SBK_MAX72xxXorPattern(uint8_t *bytes, uint16_t len, uint8_t even, uint8_t odd)
+{
+    const uint8_t pattern[4] = {even, odd, even, odd};
+    uint32_t mask;
+    memcpy(&mask, pattern, sizeof(mask));
+
+    uint16_t i = 0;
+    for (; i + sizeof(mask) <= len; i += sizeof(mask))
+    {
+        uint32_t word; // memcpy keeps this alignment- and aliasing-safe, compilers emit a plain load/store
+        memcpy(&word, bytes + i, sizeof(word));
+        word ^= mask;
+        memcpy(bytes + i, &word, sizeof(word));
+    }
+    for (; i < len; i++)
+        bytes[i] ^= (i & 1) ? odd : even;
+}
+
+/**
+ * @brief Transpose an 8x8 bit block between column bytes and row bytes.
+ *
+ * Column byte c holds row r at bit (7 - r); row byte r holds column c at bit (7 - c), so the
+ * same call converts either way. Uses the 32-bit shift-and-mask transpose (Hacker's Delight
+ * 7-3): a few dozen operations instead of 64 bit tests. @p in and @p out may be the same array.
+ *
+ * @param in  8 source bytes.
+ * @param out 8 destination bytes.
+ */
+static inline void SBK_MAX72xxTranspose8x8(const uint8_t *in, uint8_t *out)
+{
+    uint32_t x = ((uint32_t)in[0] << 24) | ((uint32_t)in[1] << 16) | ((uint32_t)in[2] << 8) | in[3];
+    uint32_t y = ((uint32_t)in[4] << 24) | ((uint32_t)in[5] << 16) | ((uint32_t)in[6] << 8) | in[7];
+    uint32_t t;
+
+    t = (x ^ (x >> 7)) & 0x00AA00AA;
+    x = x ^ t ^ (t << 7);
+    t = (y ^ (y >> 7)) & 0x00AA00AA;
+    y = y ^ t ^ (t << 7);
+
+    t = (x ^ (x >> 14)) & 0x0000CCCC;
+    x = x ^ t ^ (t << 14);
+    t = (y ^ (y >> 14)) & 0x0000CCCC;
+    y = y ^ t ^ (t << 14);
+
+    t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+    y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+    x = t;
+
+    out[0] = x >> 24;
+    out[1] = x >> 16;
+    out[2] = x >> 8;
+    out[3] = x;
+    out[4] = y >> 24;
+    out[5] = y >> 16;
+    out[6] = y >> 8;
+    out[7] = y;
+}
+
+/**
+ * @brief Read one byte of constant data that may live in flash (PROGMEM).
+ *
+ * AVR needs an LPM instruction to read program memory; other targets map flash into the
+ * address space, so this is a plain load there.
+ */
+static inline uint8_t SBK_MAX72xxReadFlash(const uint8_t *p)
+{
+#if defined(__AVR__)
+    return pgm_read_byte(p);
+#else
+    return *p;
+#endif
+}
+
+/**
+ * @brief Read one 16-bit word of constant data that may live in flash (PROGMEM).
+ */
+static inline uint16_t SBK_MAX72xxReadFlash16(const uint16_t *p)
+{
+#if defined(__AVR__)
+    return pgm_read_word(p);
+#else
+    return *p;
+#endif
+}
@@ -0,0 +1,211 @@
+/**
+ * @file SBK_MAX72xxFont.h
+ * @brief Fixed-width column-byte font description for the SBK_MAX72xx graphics layers.
+ *
+ * Part of the SBK_MAX72xx Arduino Library.
+ * Glyphs are stored in flash as column bytes in the driver's orientation (row 0 = MSB),
+ * so rendering is a straight copy into the buffer with no per-pixel work. Text is UTF-8;
+ * characters beyond ASCII come from sparse fonts searched by codepoint.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ *
+ * @version 2.0.4
+ *
+ * @license MIT
+ *
+ * @copyright
+ * Copyright (c) 2025 Samuel Barabé
+ *
+ * Repository: https://github.com/sbarabe/SBK_MAX72xx
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "SBK_MAX72xxFast.h"
+
+/**
+ * @brief Horizontal placement of text (widgets, 7-segment displays).
+ */
+enum class SBK_MAX72xxAlign : uint8_t
+{
+    Left,
+    Center,
+    Right
+};
+
+/**
+ * @struct SBK_MAX72xxFont
+ * @brief Fixed-width glyphs for a contiguous character range, or for a sparse set of codepoints.
+ *
+ * A range font maps characters first–last to consecutive glyphs. A sparse font (codepoints
+ * not nullptr) lists its codepoints in increasing order, in flash, and glyph i belongs to
+ * the i-th codepoint: lookup is a binary search, nothing is copied to RAM. Characters a font
+ * lacks are looked up in its fallback font, which must have the same width.
+ */
+struct SBK_MAX72xxFont
+{
+    const uint8_t *columns;           ///< Glyph column bytes in flash (PROGMEM), glyphs back to back
+    uint8_t first;                    ///< Range font: first character code
+    uint8_t last;                     ///< Range font: last character code
+    uint8_t width;                    ///< Columns per glyph
+    uint8_t spacing;                  ///< Blank columns after each glyph
+    const uint16_t *codepoints;       ///< Sparse font: sorted codepoints in flash (PROGMEM), nullptr for a range font
+    uint16_t count;                   ///< Sparse font: number of codepoints
+    const SBK_MAX72xxFont *fallback;  ///< Font searched for missing characters, or nullptr
+
+    /**
+     * @brief Flash address of the first column of the glyph for codepoint @p c, or nullptr if missing.
+     */
+    const uint8_t *glyph(uint16_t c) const
+    {
+        const uint8_t *found = nullptr;
+        if (codepoints)
+        {
+            // Binary search over the sorted codepoints: O(log n) flash reads
+            uint16_t lo = 0, hi = count;
+            while (lo < hi)
+            {
+                uint16_t mid = (lo + hi) / 2;
+                uint16_t cp = SBK_MAX72xxReadFlash16(codepoints + mid);
+                if (cp == c)
+                {
+                    found = columns + mid * width;
+                    break;
+                }
+                if (cp < c)
+                    lo = mid + 1;
+                else
+                    hi = mid;
+            }
+        }
+        else if (c >= first && c <= last)
+        {
+            found = columns + (c - first) * width;
+        }
+
+        return (found || !fallback) ? found : fallback->glyph(c);
+    }
+
+    /**
+     * @brief Columns taken by one glyph and its spacing.
+     */
+    uint8_t advance() const { return width + spacing; }
+};
+
+/// Built-in 5x7 ASCII font (0x20–0x7E), 1 column of spacing.
+extern const SBK_MAX72xxFont SBK_MAX72xxFont5x7;
+
+/// Built-in 5x7 sparse font with French accented letters, « » ° Œ œ €; falls back to SBK_MAX72xxFont5x7.
+extern const SBK_MAX72xxFont SBK_MAX72xxFont5x7Latin;
+
+/**
+ * @brief Decode the next UTF-8 character of @p text and advance past it.
+ *
+ * Malformed sequences decode as U+FFFD one byte at a time; codepoints above U+FFFF (not
+ * representable in font tables) also return U+FFFD.
+ *
+ * @return Codepoint, or 0 at the end of the string.
+ */
+static inline uint16_t SBK_MAX72xxUtf8Next(const char *&text)
+{
+    const uint8_t *p = reinterpret_cast<const uint8_t *>(text);
+    uint8_t lead = p[0];
+    if (lead < 0x80)
+    {
+        if (lead)
+            text++;
+        return lead;
+    }
+
+    uint8_t extra = (lead >= 0xF0) ? 3 : (lead >= 0xE0) ? 2 : (lead >= 0xC0) ? 1 : 0;
+    uint32_t cp = lead & (0x3F >> extra);
+    for (uint8_t i = 1; i <= extra; i++)
+    {
+        if ((p[i] & 0xC0) != 0x80)
+        {
+            extra = 0; // Truncated sequence
+            break;
+        }
+        cp = (cp << 6) | (p[i] & 0x3F);
+    }
+
+    if (!extra || lead >= 0xF8)
+    {
+        text++;
+        return 0xFFFD;
+    }
+
+    text += extra + 1;
+    return (cp > 0xFFFF) ? 0xFFFD : cp;
+}
+
+/**
+ * @brief Number of characters (not bytes) in a UTF-8 string.
+ */
+static inline uint16_t SBK_MAX72xxUtf8Length(const char *text)
+{
+    uint16_t n = 0;
+    while (SBK_MAX72xxUtf8Next(text))
+        n++;
+    return n;
+}
+
+#ifndef SBK_MAX72XX_GLYPH_CACHE_SIZE
+#define SBK_MAX72XX_GLYPH_CACHE_SIZE 8 ///< Entries of SBK_MAX72xxGlyphCache
+#endif
+
+/**
+ * @class SBK_MAX72xxGlyphCache
+ * @brief Small most-recently-used cache of glyph lookups, to skip the binary search for
+ *        the characters a sign keeps redrawing (digits of a clock, a short message).
+ */
+class SBK_MAX72xxGlyphCache
+{
+public:
+    /**
+     * @brief Same result as font.glyph(c), served from the cache when possible.
+     */
+    const uint8_t *glyph(const SBK_MAX72xxFont &font, uint16_t c)
+    {
+        if (&font != _font)
+        {
+            _font = &font;
+            _size = 0;
+        }
+
+        uint8_t i = 0;
+        while (i < _size && _codepoints[i] != c)
+            i++;
+
+        const uint8_t *found;
+        if (i < _size)
+        {
+            found = _glyphs[i];
+        }
+        else
+        {
+            found = font.glyph(c);
+            if (_size < SBK_MAX72XX_GLYPH_CACHE_SIZE)
+                _size++;
+            i = _size - 1; // Least recently used entry is dropped
+        }
+
+        // Move to front
+        for (; i > 0; i--)
+        {
+            _codepoints[i] = _codepoints[i - 1];
+            _glyphs[i] = _glyphs[i - 1];
+        }
+        _codepoints[0] = c;
+        _glyphs[0] = found;
+        return found;
+    }
+
+private:
+    const SBK_MAX72xxFont *_font = nullptr;
+    uint16_t _codepoints[SBK_MAX72XX_GLYPH_CACHE_SIZE];
+    const uint8_t *_glyphs[SBK_MAX72XX_GLYPH_CACHE_SIZE];
+    uint8_t _size = 0;
+};
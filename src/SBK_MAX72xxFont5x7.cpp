@@ -0,0 +1,172 @@
+/**
+ * @file SBK_MAX72xxFont5x7.cpp
+ * @brief Built-in 5x7 fonts (ASCII, and French accented Latin) for the SBK_MAX72xx graphics layers.
+ *
+ * Part of the SBK_MAX72xx Arduino Library.
+ *
+ * Printable ASCII (0x20–0x7E), 5 column bytes per glyph, row 0 = MSB like the driver
+ * buffers, so glyph columns go to setCol() unchanged. Stored in flash (PROGMEM).
+ * SBK_MAX72xxFont5x7Latin adds the accented letters of French (and « » ° Œ œ €) as a
+ * sparse font that falls back to the ASCII one.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ *
+ * @version 2.0.4
+ *
+ * @license MIT
+ *
+ * Copyright (c) 2025 Samuel Barabé
+ */
+
+#include "SBK_MAX72xxFont.h"
+
+static const uint8_t font5x7Columns[] PROGMEM = {
+    0x00, 0x00, 0x00, 0x00, 0x00, // space
+    0x00, 0x00, 0xFA, 0x00, 0x00, // !
+    0x00, 0xE0, 0x00, 0xE0, 0x00, // "
+    0x28, 0xFE, 0x28, 0xFE, 0x28, // #
+    0x24, 0x54, 0xFE, 0x54, 0x48, // $
+    0xC4, 0xC8, 0x10, 0x26, 0x46, // %
+    0x6C, 0x92, 0xAA, 0x44, 0x0A, // &
+    0x00, 0xA0, 0xC0, 0x00, 0x00, // '
+    0x00, 0x38, 0x44, 0x82, 0x00, // (
+    0x00, 0x82, 0x44, 0x38, 0x00, // )
+    0x28, 0x10, 0x7C, 0x10, 0x28, // *
+    0x10, 0x10, 0x7C, 0x10, 0x10, // +
+    0x00, 0x0A, 0x0C, 0x00, 0x00, // ,
+    0x10, 0x10, 0x10, 0x10, 0x10, // -
+    0x00, 0x06, 0x06, 0x00, 0x00, // .
+    0x04, 0x08, 0x10, 0x20, 0x40, // /
+    0x7C, 0x8A, 0x92, 0xA2, 0x7C, // 0
+    0x00, 0x42, 0xFE, 0x02, 0x00, // 1
+    0x42, 0x86, 0x8A, 0x92, 0x62, // 2
+    0x84, 0x82, 0xA2, 0xD2, 0x8C, // 3
+    0x18, 0x28, 0x48, 0xFE, 0x08, // 4
+    0xE4, 0xA2, 0xA2, 0xA2, 0x9C, // 5
+    0x3C, 0x52, 0x92, 0x92, 0x0C, // 6
+    0x80, 0x8E, 0x90, 0xA0, 0xC0, // 7
+    0x6C, 0x92, 0x92, 0x92, 0x6C, // 8
+    0x60, 0x92, 0x92, 0x94, 0x78, // 9
+    0x00, 0x6C, 0x6C, 0x00, 0x00, // :
+    0x00, 0x6A, 0x6C, 0x00, 0x00, // ;
+    0x10, 0x28, 0x44, 0x82, 0x00, // <
+    0x28, 0x28, 0x28, 0x28, 0x28, // =
+    0x00, 0x82, 0x44, 0x28, 0x10, // >
+    0x40, 0x80, 0x8A, 0x90, 0x60, // ?
+    0x4C, 0x92, 0x9E, 0x82, 0x7C, // @
+    0x7E, 0x88, 0x88, 0x88, 0x7E, // A
+    0xFE, 0x92, 0x92, 0x92, 0x6C, // B
+    0x7C, 0x82, 0x82, 0x82, 0x44, // C
+    0xFE, 0x82, 0x82, 0x44, 0x38, // D
+    0xFE, 0x92, 0x92, 0x92, 0x82, // E
+    0xFE, 0x90, 0x90, 0x90, 0x80, // F
+    0x7C, 0x82, 0x92, 0x92, 0x5E, // G
+    0xFE, 0x10, 0x10, 0x10, 0xFE, // H
+    0x00, 0x82, 0xFE, 0x82, 0x00, // I
+    0x04, 0x02, 0x82, 0xFC, 0x80, // J
+    0xFE, 0x10, 0x28, 0x44, 0x82, // K
+    0xFE, 0x02, 0x02, 0x02, 0x02, // L
+    0xFE, 0x40, 0x30, 0x40, 0xFE, // M
+    0xFE, 0x20, 0x10, 0x08, 0xFE, // N
+    0x7C, 0x82, 0x82, 0x82, 0x7C, // O
+    0xFE, 0x90, 0x90, 0x90, 0x60, // P
+    0x7C, 0x82, 0x8A, 0x84, 0x7A, // Q
+    0xFE, 0x90, 0x98, 0x94, 0x62, // R
+    0x62, 0x92, 0x92, 0x92, 0x8C, // S
+    0x80, 0x80, 0xFE, 0x80, 0x80, // T
+    0xFC, 0x02, 0x02, 0x02, 0xFC, // U
+    0xF8, 0x04, 0x02, 0x04, 0xF8, // V
+    0xFC, 0x02, 0x1C, 0x02, 0xFC, // W
+    0xC6, 0x28, 0x10, 0x28, 0xC6, // X
+    0xE0, 0x10, 0x0E, 0x10, 0xE0, // Y
+    0x86, 0x8A, 0x92, 0xA2, 0xC2, // Z
+    0x00, 0xFE, 0x82, 0x82, 0x00, // [
+    0x40, 0x20, 0x10, 0x08, 0x04, // backslash
+    0x00, 0x82, 0x82, 0xFE, 0x00, // ]
+    0x20, 0x40, 0x80, 0x40, 0x20, // ^
+    0x02, 0x02, 0x02, 0x02, 0x02, // _
+    0x00, 0x80, 0x40, 0x20, 0x00, // `
+    0x04, 0x2A, 0x2A, 0x2A, 0x1E, // a
+    0xFE, 0x12, 0x22, 0x22, 0x1C, // b
+    0x1C, 0x22, 0x22, 0x22, 0x04, // c
+    0x1C, 0x22, 0x22, 0x12, 0xFE, // d
+    0x1C, 0x2A, 0x2A, 0x2A, 0x18, // e
+    0x10, 0x7E, 0x90, 0x80, 0x40, // f
+    0x30, 0x4A, 0x4A, 0x4A, 0x7C, // g
+    0xFE, 0x10, 0x20, 0x20, 0x1E, // h
+    0x00, 0x22, 0xBE, 0x02, 0x00, // i
+    0x04, 0x02, 0x22, 0xBC, 0x00, // j
+    0xFE, 0x08, 0x14, 0x22, 0x00, // k
+    0x00, 0x82, 0xFE, 0x02, 0x00, // l
+    0x3E, 0x20, 0x18, 0x20, 0x1E, // m
+    0x3E, 0x10, 0x20, 0x20, 0x1E, // n
+    0x1C, 0x22, 0x22, 0x22, 0x1C, // o
+    0x3E, 0x28, 0x28, 0x28, 0x10, // p
+    0x10, 0x28, 0x28, 0x18, 0x3E, // q
+    0x3E, 0x10, 0x20, 0x20, 0x10, // r
+    0x12, 0x2A, 0x2A, 0x2A, 0x04, // s
+    0x20, 0xFC, 0x22, 0x02, 0x04, // t
+    0x3C, 0x02, 0x02, 0x04, 0x3E, // u
+    0x38, 0x04, 0x02, 0x04, 0x38, // v
+    0x3C, 0x02, 0x0C, 0x02, 0x3C, // w
+    0x22, 0x14, 0x08, 0x14, 0x22, // x
+    0x30, 0x0A, 0x0A, 0x0A, 0x3C, // y
+    0x22, 0x26, 0x2A, 0x32, 0x22, // z
+    0x00, 0x10, 0x6C, 0x82, 0x00, // {
+    0x00, 0x00, 0xFE, 0x00, 0x00, // |
+    0x00, 0x82, 0x6C, 0x10, 0x00, // }
+    0x08, 0x10, 0x10, 0x08, 0x10, // ~
+};
+
+const SBK_MAX72xxFont SBK_MAX72xxFont5x7 = {font5x7Columns, 0x20, 0x7E, 5, 1, nullptr, 0, nullptr};
+
+// French accented letters and a few symbols, in codepoint order. Capitals are 5 rows tall
+// under their accent; the cedilla uses row 7.
+static const uint16_t font5x7LatinCodepoints[] PROGMEM = {
+    0x00AB, 0x00B0, 0x00BB, 0x00C0, 0x00C2, 0x00C7, 0x00C8, 0x00C9,
+    0x00CA, 0x00CB, 0x00CE, 0x00CF, 0x00D4, 0x00D9, 0x00DB, 0x00DC,
+    0x00E0, 0x00E2, 0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EE,
+    0x00EF, 0x00F4, 0x00F9, 0x00FB, 0x00FC, 0x00FF, 0x0152, 0x0153,
+    0x20AC,
+};
+
+static const uint8_t font5x7LatinColumns[] PROGMEM = {
+    0x10, 0x28, 0x54, 0x28, 0x44, // U+00AB «
+    0x40, 0xA0, 0xA0, 0x40, 0x00, // U+00B0 °
+    0x44, 0x28, 0x54, 0x28, 0x10, // U+00BB »
+    0x1E, 0xA8, 0x68, 0x28, 0x1E, // U+00C0 À
+    0x1E, 0x68, 0xA8, 0x68, 0x1E, // U+00C2 Â
+    0x7C, 0x82, 0x83, 0x82, 0x44, // U+00C7 Ç
+    0x3E, 0xAA, 0x6A, 0x2A, 0x22, // U+00C8 È
+    0x3E, 0x2A, 0x6A, 0xAA, 0x22, // U+00C9 É
+    0x3E, 0x6A, 0xAA, 0x6A, 0x22, // U+00CA Ê
+    0x3E, 0xAA, 0x2A, 0xAA, 0x22, // U+00CB Ë
+    0x00, 0x62, 0xBE, 0x62, 0x00, // U+00CE Î
+    0x00, 0xA2, 0x3E, 0xA2, 0x00, // U+00CF Ï
+    0x1C, 0x62, 0xA2, 0x62, 0x1C, // U+00D4 Ô
+    0x3C, 0x82, 0x42, 0x02, 0x3C, // U+00D9 Ù
+    0x3C, 0x42, 0x82, 0x42, 0x3C, // U+00DB Û
+    0x3C, 0x82, 0x02, 0x82, 0x3C, // U+00DC Ü
+    0x04, 0xAA, 0x6A, 0x2A, 0x1E, // U+00E0 à
+    0x04, 0x6A, 0xAA, 0x6A, 0x1E, // U+00E2 â
+    0x1C, 0x22, 0x23, 0x22, 0x04, // U+00E7 ç
+    0x1C, 0xAA, 0x6A, 0x2A, 0x18, // U+00E8 è
+    0x1C, 0x2A, 0x6A, 0xAA, 0x18, // U+00E9 é
+    0x1C, 0x6A, 0xAA, 0x6A, 0x18, // U+00EA ê
+    0x1C, 0xAA, 0x2A, 0xAA, 0x18, // U+00EB ë
+    0x00, 0x62, 0xBE, 0x42, 0x00, // U+00EE î
+    0x00, 0xA2, 0x3E, 0x82, 0x00, // U+00EF ï
+    0x1C, 0x62, 0xA2, 0x62, 0x1C, // U+00F4 ô
+    0x3C, 0x82, 0x42, 0x04, 0x3E, // U+00F9 ù
+    0x3C, 0x42, 0x82, 0x44, 0x3E, // U+00FB û
+    0x3C, 0x82, 0x02, 0x84, 0x3E, // U+00FC ü
+    0x30, 0x8A, 0x0A, 0x8A, 0x3C, // U+00FF ÿ
+    0x7C, 0x82, 0xFE, 0x92, 0x92, // U+0152 Œ
+    0x1C, 0x22, 0x1C, 0x2A, 0x1A, // U+0153 œ
+    0x28, 0x7C, 0xAA, 0xAA, 0x82, // U+20AC €
+};
+
+const SBK_MAX72xxFont SBK_MAX72xxFont5x7Latin = {font5x7LatinColumns, 0, 0, 5, 1, font5x7LatinCodepoints,
+                                                 sizeof(font5x7LatinCodepoints) / sizeof(font5x7LatinCodepoints[0]),
+                                                 &SBK_MAX72xxFont5x7};
@@ -43,9 +43,26 @@ SBK_MAX72xxHard::SBK_MAX72xxHard(uint8_t csPin,
       _csPin(csPin),
       _devsNum(constrain(devsNum, 1, 8))
 {
+    _update = new uint8_t[_devsNum]();
+
+    // One ready-to-send frame per digit register, in wire order (last device first)
+    _frames = new uint8_t[_defaultColBufferSize * _frameBytes()];
+    for (uint8_t colIdx = 0; colIdx < _defaultColBufferSize; colIdx++)
+    {
+        uint8_t *frame = _frames + colIdx * _frameBytes();
+        for (uint8_t k = 0; k < _devsNum; k++)
+        {
+            *frame++ = OP_DIGIT0 + colIdx;
+            *frame++ = 0x00;
+        }
+    }
+
+#ifdef SBK_MAX72XX_WIRE_ORDER_BUFFER
+    _buffer = _frames; // The frames are the display buffer, see _colIndex()
+#else
     _buffer = new uint8_t[_devsNum * _defaultColBufferSize];
-    _update = new bool[_devsNum]();
     memset(_buffer, 0, _devsNum * _defaultColBufferSize);
+#endif
 }
 
 void SBK_MAX72xxHard::setSPIClock(uint32_t frequency)
@@ -61,8 +78,11 @@ void SBK_MAX72xxHard::end()
 SBK_MAX72xxHard::~SBK_MAX72xxHard()
 {
     // Release the dynamically allocated memory
+#ifndef SBK_MAX72XX_WIRE_ORDER_BUFFER
     delete[] _buffer;
+#endif
     delete[] _update;
+    delete[] _frames;
 }
 
 void SBK_MAX72xxHard::begin()
@@ -95,6 +115,11 @@ void SBK_MAX72xxHard::setScanLimit(uint8_t devIdx, uint8_t limit)
     _spiTransfer(devIdx, OP_SCANLIMIT, limit & 0x07);
 }
 
+void SBK_MAX72xxHard::setDecodeMode(uint8_t devIdx, uint8_t mask)
+{
+    _spiTransfer(devIdx, OP_DECODEMODE, mask);
+}
+
 void SBK_MAX72xxHard::setBrightness(uint8_t devIdx, uint8_t brightness)
 {
     // constrain the brightness to a 4-bit number (0–15)
@@ -103,26 +128,48 @@ void SBK_MAX72xxHard::setBrightness(uint8_t devIdx, uint8_t brightness)
     _spiTransfer(devIdx, OP_INTENSITY, brightness & 0x0F);
 }
 
+void SBK_MAX72xxHard::setBrightness(const uint8_t *levels)
+{
+    if (!levels)
+        return;
+
+    // One frame: every device latches its own intensity at once
+    _spiTransferAll(OP_INTENSITY, levels, 0x0F);
+}
+
 void SBK_MAX72xxHard::clear(uint8_t devIdx)
 {
     if (devIdx >= _devsNum)
         return;
 
-    _update[devIdx] = true; // Mark this device for update
-
     for (uint8_t colIdx = 0; colIdx < maxColumns(); colIdx++)
     {
         _buffer[_colIndex(devIdx, colIdx)] = 0x00;
+        _frames[_frameIndex(devIdx, colIdx)] = 0x00;
         _spiTransfer(devIdx, OP_DIGIT0 + colIdx, 0x00);
     }
 }
 
 void SBK_MAX72xxHard::clear()
 {
+#ifdef SBK_MAX72XX_REFERENCE_FLUSH
     for (uint8_t d = 0; d < _devsNum; d++)
     {
         clear(d);
     }
+#else
+    // Zero the whole chain with 8 chain-packed frames instead of 8 frames per device
+    for (uint8_t d = 0; d < _devsNum; d++)
+    {
+        for (uint8_t colIdx = 0; colIdx < maxColumns(); colIdx++)
+        {
+            _buffer[_colIndex(d, colIdx)] = 0x00;
+            _markCol(d, colIdx);
+        }
+    }
+
+    show();
+#endif
 }
 
 void SBK_MAX72xxHard::setLed(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx, bool state)
@@ -139,16 +186,7 @@ void SBK_MAX72xxHard::setLed(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx, boo
         val &= ~_bitMaskRow(devIdx, rowIdx);
 
     if (val != prior)
-        _update[devIdx] = true;
-
-    Serial.print("[setLed] Dev: ");
-    Serial.print(devIdx);
-    Serial.print(" Row: ");
-    Serial.print(rowIdx);
-    Serial.print(" Col: ");
-    Serial.print(colIdx);
-    Serial.print(" State: ");
-    Serial.println(state ? "ON" : "OFF");
+        _markCol(devIdx, colIdx);
 }
 
 bool SBK_MAX72xxHard::getLed(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx) const
@@ -159,6 +197,60 @@ bool SBK_MAX72xxHard::getLed(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx) con
     return (_buffer[_colIndex(devIdx, colIdx)] & _bitMaskRow(devIdx, rowIdx)) != 0;
 }
 
+uint8_t SBK_MAX72xxHard::getCol(uint8_t devIdx, uint8_t colIdx) const
+{
+    if (devIdx >= _devsNum || colIdx >= maxColumns())
+        return 0;
+
+    return _buffer[_colIndex(devIdx, colIdx)];
+}
+
+void SBK_MAX72xxHard::getFrame(uint8_t devIdx, uint8_t *out, bool rowMajor) const
+{
+    if (devIdx >= _devsNum || !out)
+        return;
+
+    for (uint8_t colIdx = 0; colIdx < maxColumns(); colIdx++)
+        out[colIdx] = _buffer[_colIndex(devIdx, colIdx)];
+
+    if (rowMajor)
+        SBK_MAX72xxTranspose8x8(out, out);
+}
+
+uint16_t SBK_MAX72xxHard::copyRegion(uint16_t x, uint16_t width, uint8_t *out, bool rowMajor) const
+{
+    const uint16_t colsNum = _devsNum * maxColumns();
+    if (!out || x >= colsNum)
+        return 0;
+
+    if (width > colsNum - x)
+        width = colsNum - x;
+
+    if (!rowMajor)
+    {
+        for (uint16_t i = 0; i < width; i++, x++)
+            out[i] = _buffer[_colIndex(x / maxColumns(), x % maxColumns())];
+        return width;
+    }
+
+    // Row-major: transpose one 8-column block at a time into 8 rows of stride bytes
+    const uint16_t stride = (width + 7) / 8;
+    for (uint16_t block = 0; block < stride; block++)
+    {
+        uint8_t cols[8] = {0};
+        for (uint8_t i = 0; i < 8 && block * 8 + i < width; i++)
+        {
+            uint16_t col = x + block * 8 + i;
+            cols[i] = _buffer[_colIndex(col / maxColumns(), col % maxColumns())];
+        }
+
+        SBK_MAX72xxTranspose8x8(cols, cols);
+        for (uint8_t rowIdx = 0; rowIdx < 8; rowIdx++)
+            out[rowIdx * stride + block] = cols[rowIdx];
+    }
+    return width;
+}
+
 void SBK_MAX72xxHard::setCol(uint8_t devIdx, uint8_t colIdx, uint8_t value)
 {
     if (devIdx >= _devsNum || colIdx >= maxColumns())
@@ -167,12 +259,101 @@ void SBK_MAX72xxHard::setCol(uint8_t devIdx, uint8_t colIdx, uint8_t value)
     if (_buffer[_colIndex(devIdx, colIdx)] != value)
     {
         _buffer[_colIndex(devIdx, colIdx)] = value;
-        _update[devIdx] = true; // Mark device for update
+        _markCol(devIdx, colIdx); // Mark device and digit frame for update
+    }
+}
+
+void SBK_MAX72xxHard::setLedFast(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx, bool state)
+{
+    SBK_MAX72XX_ASSERT(devIdx < _devsNum && rowIdx < maxRows(devIdx) && colIdx < maxColumns());
+
+    uint8_t &val = _buffer[_colIndex(devIdx, colIdx)];
+    uint8_t next = state ? (val | SBK_MAX72xxRowMask[rowIdx]) : (val & ~SBK_MAX72xxRowMask[rowIdx]);
+
+    if (next != val)
+    {
+        val = next;
+        _markCol(devIdx, colIdx);
+    }
+}
+
+void SBK_MAX72xxHard::togglePixel(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx)
+{
+    SBK_MAX72XX_ASSERT(devIdx < _devsNum && rowIdx < maxRows(devIdx) && colIdx < maxColumns());
+
+    _buffer[_colIndex(devIdx, colIdx)] ^= SBK_MAX72xxRowMask[rowIdx];
+    _markCol(devIdx, colIdx);
+}
+
+void SBK_MAX72xxHard::writePixelSpan(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx, uint8_t len, bool state)
+{
+    SBK_MAX72XX_ASSERT(devIdx < _devsNum && rowIdx < maxRows(devIdx) && colIdx + len <= maxColumns());
+
+    const uint8_t mask = SBK_MAX72xxRowMask[rowIdx];
+    for (uint8_t end = colIdx + len; colIdx < end; colIdx++)
+    {
+        uint8_t &val = _buffer[_colIndex(devIdx, colIdx)];
+        uint8_t next = state ? (val | mask) : (val & ~mask);
+
+        if (next != val)
+        {
+            val = next;
+            _markCol(devIdx, colIdx);
+        }
+    }
+}
+
+void SBK_MAX72xxHard::toggleLed(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx)
+{
+    if (devIdx >= _devsNum || rowIdx >= maxRows(devIdx) || colIdx >= maxColumns())
+        return;
+
+    _buffer[_colIndex(devIdx, colIdx)] ^= _bitMaskRow(devIdx, rowIdx);
+    _markCol(devIdx, colIdx);
+}
+
+void SBK_MAX72xxHard::invert(uint8_t devIdx)
+{
+    if (devIdx >= _devsNum)
+        return;
+
+    for (uint8_t colIdx = 0; colIdx < maxColumns(); colIdx++)
+    {
+        _buffer[_colIndex(devIdx, colIdx)] ^= 0xFF;
+        _markCol(devIdx, colIdx);
+    }
+}
+
+void SBK_MAX72xxHard::invertAll()
+{
+#ifndef SBK_MAX72XX_WIRE_ORDER_BUFFER
+    SBK_MAX72xxXorPattern(_buffer, _devsNum * _defaultColBufferSize, 0xFF, 0xFF);
+#endif
+    // Flip the data bytes of the digit frames, leave the opcodes alone
+    SBK_MAX72xxXorPattern(_frames, _defaultColBufferSize * _frameBytes(), 0x00, 0xFF);
+    _dirtyCols = 0xFF;
+    for (uint8_t devIdx = 0; devIdx < _devsNum; devIdx++)
+        _update[devIdx] = 0xFF;
+}
+
+void SBK_MAX72xxHard::writeMasked(uint8_t devIdx, uint8_t colIdx, uint8_t mask, uint8_t value)
+{
+    if (devIdx >= _devsNum || colIdx >= maxColumns())
+        return;
+
+    uint8_t &val = _buffer[_colIndex(devIdx, colIdx)];
+    uint8_t next = (val & ~mask) | (value & mask);
+
+    if (next != val)
+    {
+        val = next;
+        _markCol(devIdx, colIdx);
     }
 }
 
 void SBK_MAX72xxHard::show()
 {
+#ifdef SBK_MAX72XX_REFERENCE_FLUSH
     SPI.beginTransaction(SPISettings(_spiClock, MSBFIRST, SPI_MODE0));
     for (uint8_t devIdx = 0; devIdx < _devsNum; devIdx++)
     {
@@ -182,24 +363,46 @@ void SBK_MAX72xxHard::show()
             {
                 _writeColToAllDevices(devIdx, colIdx, _buffer[_colIndex(devIdx, colIdx)]);
             }
-            _update[devIdx] = false;
+            _update[devIdx] = 0;
         }
     }
     SPI.endTransaction(); // 💡 Restores SPI state for other users
+#else
+    if (!_dirtyCols)
+        return;
+
+    SPI.beginTransaction(SPISettings(_spiClock, MSBFIRST, SPI_MODE0));
+    // Digit frames are kept ready to send: only push the digits that changed
+    for (uint8_t colIdx = 0; colIdx < maxColumns(); colIdx++)
+    {
+        if (_dirtyCols & (1 << colIdx))
+            _writeFrame(_frames + colIdx * _frameBytes());
+    }
+    SPI.endTransaction(); // 💡 Restores SPI state for other users
+    _dirtyCols = 0;
+
+    for (uint8_t devIdx = 0; devIdx < _devsNum; devIdx++)
+        _update[devIdx] = 0;
+#endif
 }
 
 void SBK_MAX72xxHard::show(uint8_t devIdx)
 {
-    SPI.beginTransaction(SPISettings(_spiClock, MSBFIRST, SPI_MODE0));
     if (devIdx >= _devsNum || !_update[devIdx])
         return;
 
+    SPI.beginTransaction(SPISettings(_spiClock, MSBFIRST, SPI_MODE0));
     for (uint8_t colIdx = 0; colIdx < maxColumns(); colIdx++)
     {
         _writeColToAllDevices(devIdx, colIdx, _buffer[_colIndex(devIdx, colIdx)]);
     }
-    _update[devIdx] = false;
     SPI.endTransaction(); // 💡 Restores SPI state for other users
+    _update[devIdx] = 0;
+
+    // Keep only the digits another device still waits for
+    _dirtyCols = 0;
+    for (uint8_t i = 0; i < _devsNum; i++)
+        _dirtyCols |= _update[i];
 }
 
 void SBK_MAX72xxHard::testMode(uint8_t devIdx, bool enable)
@@ -217,18 +420,31 @@ void SBK_MAX72xxHard::_spiTransfer(uint8_t targetDevice, uint8_t opcode, uint8_t
     if (targetDevice >= _devsNum)
         return; // Prevent invalid access
 
-    digitalWrite(_csPin, LOW);
+    _beginFrame();
 
     for (int8_t i = _devsNum - 1; i >= 0; i--)
     {
         uint8_t op = (i == static_cast<int8_t>(targetDevice)) ? opcode : OP_NOOP;
         uint8_t val = (i == static_cast<int8_t>(targetDevice)) ? data : 0;
 
-        SPI.transfer(op);
-        SPI.transfer(val);
+        _shiftByte(op);
+        _shiftByte(val);
     }
 
-    digitalWrite(_csPin, HIGH);
+    _endFrame();
+}
+
+void SBK_MAX72xxHard::_spiTransferAll(uint8_t opcode, const uint8_t *data, uint8_t mask)
+{
+    _beginFrame();
+
+    for (int8_t i = _devsNum - 1; i >= 0; i--)
+    {
+        _shiftByte(opcode);
+        _shiftByte(data[i] & mask);
+    }
+
+    _endFrame();
 }
 
 inline void SBK_MAX72xxHard::_writeColToAllDevices(uint8_t targetDevice, uint8_t colIdx, uint8_t data)
@@ -236,26 +452,89 @@ inline void SBK_MAX72xxHard::_writeColToAllDevices(uint8_t targetDevice, uint8_t
     if (targetDevice >= _devsNum || colIdx >= maxColumns())
         return;
 
-    digitalWrite(_csPin, LOW);
+    _beginFrame();
 
     for (int8_t i = _devsNum - 1; i >= 0; i--)
     {
         uint8_t opcode = (i == static_cast<int8_t>(targetDevice)) ? (OP_DIGIT0 + colIdx) : OP_NOOP;
         uint8_t val = (i == static_cast<int8_t>(targetDevice)) ? data : 0;
 
-        SPI.transfer(opcode);
-        SPI.transfer(val);
+        _shiftByte(opcode);
+        _shiftByte(val);
     }
 
+    _endFrame();
+}
+
+inline void SBK_MAX72xxHard::_beginFrame()
+{
+    digitalWrite(_csPin, LOW);
+    if (_capture)
+        _capture->beginFrame();
+}
+
+inline void SBK_MAX72xxHard::_shiftByte(uint8_t data)
+{
+    SPI.transfer(data);
+    if (_capture)
+        _capture->push(data);
+}
+
+inline void SBK_MAX72xxHard::_endFrame()
+{
+    digitalWrite(_csPin, HIGH);
+    if (_capture)
+        _capture->endFrame();
+}
+
+void SBK_MAX72xxHard::_writeFrame(const uint8_t *frame)
+{
+    if (_capture)
+        _capture->beginFrame();
+
+    digitalWrite(_csPin, LOW);
+#if defined(ESP32)
+    SPI.writeBytes(frame, _frameBytes()); // Bulk write, nothing read back into the template
+#else
+    for (uint8_t i = 0; i < _frameBytes(); i++)
+        SPI.transfer(frame[i]);
+#endif
     digitalWrite(_csPin, HIGH);
+
+    if (_capture)
+    {
+        for (uint8_t i = 0; i < _frameBytes(); i++)
+            _capture->push(frame[i]);
+        _capture->endFrame();
+    }
+}
+
+inline void SBK_MAX72xxHard::_markCol(uint8_t devIdx, uint8_t colIdx)
+{
+#ifndef SBK_MAX72XX_WIRE_ORDER_BUFFER
+    _frames[_frameIndex(devIdx, colIdx)] = _buffer[_colIndex(devIdx, colIdx)];
+#endif
+    _dirtyCols |= 1 << colIdx;
+    _update[devIdx] |= 1 << colIdx;
 }
 
 inline uint8_t SBK_MAX72xxHard::_bitMaskRow(uint8_t devIdx, uint8_t rowIdx) const
 {
-    return 1 << ((maxRows(devIdx) - 1) - rowIdx);
+    (void)devIdx;
+    return SBK_MAX72xxRowMask[rowIdx]; // Same as 1 << (maxRows() - 1 - rowIdx), without the shift loop on AVR
 }
 
 inline uint8_t SBK_MAX72xxHard::_colIndex(uint8_t devIdx, uint8_t colIdx) const
 {
+#ifdef SBK_MAX72XX_WIRE_ORDER_BUFFER
+    return _frameIndex(devIdx, colIdx);
+#else
     return devIdx * _defaultColBufferSize + colIdx;
+#endif
+}
+
+inline uint8_t SBK_MAX72xxHard::_frameIndex(uint8_t devIdx, uint8_t colIdx) const
+{
+    // Data byte of device devIdx inside digit frame colIdx (wire order: device N-1 first)
+    return colIdx * _frameBytes() + (_devsNum - 1 - devIdx) * 2 + 1;
 }
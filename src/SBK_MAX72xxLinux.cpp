@@ -0,0 +1,586 @@
+/**
+ * @file SBK_MAX72xxLinux.cpp
+ * @brief Implementation of the SBK_MAX72xxLinux class for controlling MAX7219/MAX7221 LED drivers.
+ *
+ * Part of the SBK_MAX72xx Arduino Library.
+ *
+ * This file contains the method implementations for managing multiple daisy-chained
+ * MAX7219/MAX7221 chips from Linux userspace through spidev and the GPIO character device,
+ * plus an in-memory fake device. It compiles to nothing in Arduino builds.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ *
+ * @version 2.0.4
+ *
+ * @license MIT
+ *
+ * Copyright (c) 2025 Samuel Barabé
+ */
+
+#if defined(__linux__) && !defined(ARDUINO)
+
+#include "SBK_MAX72xxLinux.h"
+
+#include <fcntl.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+#include <linux/gpio.h>
+#include <linux/spi/spidev.h>
+
+// MAX7219/MAX7221 Opcodes
+#define OP_NOOP 0x00
+#define OP_DIGIT0 0x01
+#define OP_DIGIT1 0x02
+#define OP_DIGIT2 0x03
+#define OP_DIGIT3 0x04
+#define OP_DIGIT4 0x05
+#define OP_DIGIT5 0x06
+#define OP_DIGIT6 0x07
+#define OP_DIGIT7 0x08
+#define OP_DECODEMODE 0x09
+#define OP_INTENSITY 0x0A
+#define OP_SCANLIMIT 0x0B
+#define OP_SHUTDOWN 0x0C
+#define OP_DISPLAYTEST 0x0F
+
+static uint8_t constrainDevsNum(uint8_t devsNum)
+{
+    return devsNum < 1 ? 1 : (devsNum > 8 ? 8 : devsNum);
+}
+
+SBK_MAX72xxLinux::SBK_MAX72xxLinux(const char *spiDevice,
+                                   uint8_t devsNum,
+                                   const char *gpioChip,
+                                   uint32_t csLine)
+    : _spiDevice(spiDevice),
+      _gpioChip(gpioChip),
+      _csLine(csLine),
+      _devsNum(constrainDevsNum(devsNum))
+{
+    _buffer = new uint8_t[_devsNum * _defaultColBufferSize];
+    _update = new bool[_devsNum]();
+    memset(_buffer, 0, _devsNum * _defaultColBufferSize);
+    _txBuffer = new uint8_t[_defaultColBufferSize * _frameBytes()];
+}
+
+SBK_MAX72xxLinux::SBK_MAX72xxLinux(uint8_t devsNum)
+    : _devsNum(constrainDevsNum(devsNum)),
+      _fake(true)
+{
+    _buffer = new uint8_t[_devsNum * _defaultColBufferSize];
+    _update = new bool[_devsNum]();
+    memset(_buffer, 0, _devsNum * _defaultColBufferSize);
+    _txBuffer = new uint8_t[_defaultColBufferSize * _frameBytes()];
+    _fakeChain = new SBK_MAX72xxChainSim(_devsNum);
+}
+
+void SBK_MAX72xxLinux::setSPIClock(uint32_t frequency)
+{
+    _spiClock = frequency;
+}
+
+void SBK_MAX72xxLinux::end()
+{
+    if (_csFd >= 0)
+    {
+        close(_csFd);
+        _csFd = -1;
+    }
+    if (_spiFd >= 0)
+    {
+        close(_spiFd);
+        _spiFd = -1;
+    }
+}
+
+SBK_MAX72xxLinux::~SBK_MAX72xxLinux()
+{
+    end();
+
+    // Release the dynamically allocated memory
+    delete _fakeChain;
+    delete[] _txBuffer;
+    delete[] _buffer;
+    delete[] _update;
+}
+
+void SBK_MAX72xxLinux::begin()
+{
+    if (!_fake && _spiFd < 0)
+    {
+        _spiFd = open(_spiDevice, O_RDWR);
+        if (_spiFd < 0)
+            return;
+
+        uint8_t mode = SPI_MODE_0;
+        uint8_t bits = 8;
+        if (_gpioChip)
+        {
+            // CS comes from the GPIO line; keep the controller's own CS quiet if it can
+            uint8_t noCs = mode | SPI_NO_CS;
+            if (ioctl(_spiFd, SPI_IOC_WR_MODE, &noCs) == 0)
+                mode = noCs;
+        }
+        if (ioctl(_spiFd, SPI_IOC_WR_MODE, &mode) < 0 ||
+            ioctl(_spiFd, SPI_IOC_WR_BITS_PER_WORD, &bits) < 0 ||
+            ioctl(_spiFd, SPI_IOC_WR_MAX_SPEED_HZ, &_spiClock) < 0)
+        {
+            end();
+            return;
+        }
+
+        if (_gpioChip)
+        {
+            int chipFd = open(_gpioChip, O_RDWR);
+            if (chipFd < 0)
+            {
+                end();
+                return;
+            }
+
+            struct gpio_v2_line_request req;
+            memset(&req, 0, sizeof(req));
+            req.offsets[0] = _csLine;
+            req.num_lines = 1;
+            strncpy(req.consumer, "SBK_MAX72xx", sizeof(req.consumer) - 1);
+            req.config.flags = GPIO_V2_LINE_FLAG_OUTPUT;
+            req.config.num_attrs = 1;
+            req.config.attrs[0].attr.id = GPIO_V2_LINE_ATTR_ID_OUTPUT_VALUES;
+            req.config.attrs[0].attr.values = 1; // ensure chip deselected early
+            req.config.attrs[0].mask = 1;
+
+            int err = ioctl(chipFd, GPIO_V2_GET_LINE_IOCTL, &req);
+            close(chipFd); // The line request keeps its own descriptor
+            if (err < 0)
+            {
+                end();
+                return;
+            }
+            _csFd = req.fd;
+        }
+    }
+    if (!_fake)
+        usleep(50000); // small stabilization delay (simulated chips need none)
+
+    for (uint8_t i = 0; i < _devsNum; ++i)
+    {
+        setShutdown(i, false);             // Wake up
+        setScanLimit(i, maxColumns() - 1); // Display all 8 digits
+        _spiTransfer(i, OP_DECODEMODE, 0); // No decode
+        testMode(i, false);                // Ensure test mode is OFF
+        setBrightness(i, 8);               // Medium brightness
+    }
+    clear(); // One pass clears the whole chain
+}
+
+uint8_t SBK_MAX72xxLinux::fakeRegister(uint8_t devIdx, uint8_t opcode) const
+{
+    return _fakeChain ? _fakeChain->reg(devIdx, opcode) : 0;
+}
+
+void SBK_MAX72xxLinux::setShutdown(uint8_t devIdx, bool status)
+{
+    _spiTransfer(devIdx, OP_SHUTDOWN, status ? 0 : 1);
+}
+
+void SBK_MAX72xxLinux::setScanLimit(uint8_t devIdx, uint8_t limit)
+{
+    _spiTransfer(devIdx, OP_SCANLIMIT, limit & 0x07);
+}
+
+void SBK_MAX72xxLinux::setDecodeMode(uint8_t devIdx, uint8_t mask)
+{
+    _spiTransfer(devIdx, OP_DECODEMODE, mask);
+}
+
+void SBK_MAX72xxLinux::setBrightness(uint8_t devIdx, uint8_t brightness)
+{
+    // constrain the brightness to a 4-bit number (0–15)
+    _spiTransfer(devIdx, OP_INTENSITY, brightness & 0x0F);
+}
+
+void SBK_MAX72xxLinux::setBrightness(const uint8_t *levels)
+{
+    if (!levels)
+        return;
+
+    // One frame: every device latches its own intensity at once
+    _spiTransferAll(OP_INTENSITY, levels, 0x0F);
+}
+
+void SBK_MAX72xxLinux::clear(uint8_t devIdx)
+{
+    if (devIdx >= _devsNum)
+        return;
+
+    _update[devIdx] = true; // Mark this device for update
+
+    for (uint8_t colIdx = 0; colIdx < maxColumns(); colIdx++)
+    {
+        _buffer[_colIndex(devIdx, colIdx)] = 0x00;
+        _spiTransfer(devIdx, OP_DIGIT0 + colIdx, 0x00);
+    }
+}
+
+void SBK_MAX72xxLinux::clear()
+{
+    // Zero the whole chain with 8 chain-packed frames instead of 8 frames per device
+    memset(_buffer, 0, _devsNum * _defaultColBufferSize);
+    for (uint8_t d = 0; d < _devsNum; d++)
+        _update[d] = true;
+
+    show();
+}
+
+void SBK_MAX72xxLinux::setLed(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx, bool state)
+{
+    if (devIdx >= _devsNum || rowIdx >= maxRows(devIdx) || colIdx >= maxColumns())
+        return;
+
+    uint8_t &val = _buffer[_colIndex(devIdx, colIdx)];
+    uint8_t prior = val;
+
+    if (state)
+        val |= _bitMaskRow(devIdx, rowIdx);
+    else
+        val &= ~_bitMaskRow(devIdx, rowIdx);
+
+    if (val != prior)
+        _update[devIdx] = true;
+}
+
+bool SBK_MAX72xxLinux::getLed(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx) const
+{
+    if (devIdx >= _devsNum || rowIdx >= maxRows(devIdx) || colIdx >= maxColumns())
+        return false;
+
+    return (_buffer[_colIndex(devIdx, colIdx)] & _bitMaskRow(devIdx, rowIdx)) != 0;
+}
+
+uint8_t SBK_MAX72xxLinux::getCol(uint8_t devIdx, uint8_t colIdx) const
+{
+    if (devIdx >= _devsNum || colIdx >= maxColumns())
+        return 0;
+
+    return _buffer[_colIndex(devIdx, colIdx)];
+}
+
+void SBK_MAX72xxLinux::getFrame(uint8_t devIdx, uint8_t *out, bool rowMajor) const
+{
+    if (devIdx >= _devsNum || !out)
+        return;
+
+    for (uint8_t colIdx = 0; colIdx < maxColumns(); colIdx++)
+        out[colIdx] = _buffer[_colIndex(devIdx, colIdx)];
+
+    if (rowMajor)
+        SBK_MAX72xxTranspose8x8(out, out);
+}
+
+uint16_t SBK_MAX72xxLinux::copyRegion(uint16_t x, uint16_t width, uint8_t *out, bool rowMajor) const
+{
+    const uint16_t colsNum = _devsNum * maxColumns();
+    if (!out || x >= colsNum)
+        return 0;
+
+    if (width > colsNum - x)
+        width = colsNum - x;
+
+    if (!rowMajor)
+    {
+        for (uint16_t i = 0; i < width; i++, x++)
+            out[i] = _buffer[_colIndex(x / maxColumns(), x % maxColumns())];
+        return width;
+    }
+
+    // Row-major: transpose one 8-column block at a time into 8 rows of stride bytes
+    const uint16_t stride = (width + 7) / 8;
+    for (uint16_t block = 0; block < stride; block++)
+    {
+        uint8_t cols[8] = {0};
+        for (uint8_t i = 0; i < 8 && block * 8 + i < width; i++)
+        {
+            uint16_t col = x + block * 8 + i;
+            cols[i] = _buffer[_colIndex(col / maxColumns(), col % maxColumns())];
+        }
+
+        SBK_MAX72xxTranspose8x8(cols, cols);
+        for (uint8_t rowIdx = 0; rowIdx < 8; rowIdx++)
+            out[rowIdx * stride + block] = cols[rowIdx];
+    }
+    return width;
+}
+
+void SBK_MAX72xxLinux::setCol(uint8_t devIdx, uint8_t colIdx, uint8_t value)
+{
+    if (devIdx >= _devsNum || colIdx >= maxColumns())
+        return;
+
+    if (_buffer[_colIndex(devIdx, colIdx)] != value)
+    {
+        _buffer[_colIndex(devIdx, colIdx)] = value;
+        _update[devIdx] = true; // Mark device for update
+    }
+}
+
+void SBK_MAX72xxLinux::setLedFast(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx, bool state)
+{
+    SBK_MAX72XX_ASSERT(devIdx < _devsNum && rowIdx < maxRows(devIdx) && colIdx < maxColumns());
+
+    uint8_t &val = _buffer[_colIndex(devIdx, colIdx)];
+    uint8_t next = state ? (val | SBK_MAX72xxRowMask[rowIdx]) : (val & ~SBK_MAX72xxRowMask[rowIdx]);
+
+    if (next != val)
+    {
+        val = next;
+        _update[devIdx] = true;
+    }
+}
+
+void SBK_MAX72xxLinux::togglePixel(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx)
+{
+    SBK_MAX72XX_ASSERT(devIdx < _devsNum && rowIdx < maxRows(devIdx) && colIdx < maxColumns());
+
+    _buffer[_colIndex(devIdx, colIdx)] ^= SBK_MAX72xxRowMask[rowIdx];
+    _update[devIdx] = true;
+}
+
+void SBK_MAX72xxLinux::writePixelSpan(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx, uint8_t len, bool state)
+{
+    SBK_MAX72XX_ASSERT(devIdx < _devsNum && rowIdx < maxRows(devIdx) && colIdx + len <= maxColumns());
+
+    const uint8_t mask = SBK_MAX72xxRowMask[rowIdx];
+    for (uint8_t end = colIdx + len; colIdx < end; colIdx++)
+    {
+        uint8_t &val = _buffer[_colIndex(devIdx, colIdx)];
+        uint8_t next = state ? (val | mask) : (val & ~mask);
+
+        if (next != val)
+        {
+            val = next;
+            _update[devIdx] = true;
+        }
+    }
+}
+
+void SBK_MAX72xxLinux::toggleLed(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx)
+{
+    if (devIdx >= _devsNum || rowIdx >= maxRows(devIdx) || colIdx >= maxColumns())
+        return;
+
+    _buffer[_colIndex(devIdx, colIdx)] ^= _bitMaskRow(devIdx, rowIdx);
+    _update[devIdx] = true;
+}
+
+void SBK_MAX72xxLinux::invert(uint8_t devIdx)
+{
+    if (devIdx >= _devsNum)
+        return;
+
+    for (uint8_t colIdx = 0; colIdx < maxColumns(); colIdx++)
+    {
+        _buffer[_colIndex(devIdx, colIdx)] ^= 0xFF;
+        _update[devIdx] = true;
+    }
+}
+
+void SBK_MAX72xxLinux::invertAll()
+{
+    SBK_MAX72xxXorPattern(_buffer, _devsNum * _defaultColBufferSize, 0xFF, 0xFF);
+    for (uint8_t devIdx = 0; devIdx < _devsNum; devIdx++)
+        _update[devIdx] = true;
+}
+
+void SBK_MAX72xxLinux::writeMasked(uint8_t devIdx, uint8_t colIdx, uint8_t mask, uint8_t value)
+{
+    if (devIdx >= _devsNum || colIdx >= maxColumns())
+        return;
+
+    uint8_t &val = _buffer[_colIndex(devIdx, colIdx)];
+    uint8_t next = (val & ~mask) | (value & mask);
+
+    if (next != val)
+    {
+        val = next;
+        _update[devIdx] = true;
+    }
+}
+
+void SBK_MAX72xxLinux::show()
+{
+    if (!ready() || !_anyUpdate())
+        return;
+
+    for (uint8_t colIdx = 0; colIdx < maxColumns(); colIdx++)
+    {
+        _fillColToUpdatedDevices(colIdx, _txBuffer + colIdx * _frameBytes());
+    }
+    _writeFrames(_txBuffer, maxColumns());
+
+    for (uint8_t devIdx = 0; devIdx < _devsNum; devIdx++)
+        _update[devIdx] = false;
+}
+
+void SBK_MAX72xxLinux::show(uint8_t devIdx)
+{
+    if (devIdx >= _devsNum || !_update[devIdx])
+        return;
+
+    for (uint8_t colIdx = 0; colIdx < maxColumns(); colIdx++)
+    {
+        _writeColToAllDevices(devIdx, colIdx, _buffer[_colIndex(devIdx, colIdx)]);
+    }
+    _update[devIdx] = false;
+}
+
+void SBK_MAX72xxLinux::testMode(uint8_t devIdx, bool enable)
+{
+    if (devIdx >= _devsNum)
+        return;
+
+    // MAX7219 test mode uses register 0x0F
+    // value 1 = test ON (all segments), 0 = test OFF
+    _spiTransfer(devIdx, OP_DISPLAYTEST, enable ? 1 : 0);
+}
+
+void SBK_MAX72xxLinux::_spiTransfer(uint8_t targetDevice, uint8_t opcode, uint8_t data)
+{
+    if (targetDevice >= _devsNum)
+        return; // Prevent invalid access
+
+    uint8_t frame[16];
+    uint8_t *out = frame;
+    for (int8_t i = _devsNum - 1; i >= 0; i--)
+    {
+        bool target = (i == static_cast<int8_t>(targetDevice));
+        *out++ = target ? opcode : OP_NOOP;
+        *out++ = target ? data : 0;
+    }
+
+    _writeFrames(frame, 1);
+}
+
+void SBK_MAX72xxLinux::_spiTransferAll(uint8_t opcode, const uint8_t *data, uint8_t mask)
+{
+    uint8_t frame[16];
+    uint8_t *out = frame;
+    for (int8_t i = _devsNum - 1; i >= 0; i--)
+    {
+        *out++ = opcode;
+        *out++ = data[i] & mask;
+    }
+
+    _writeFrames(frame, 1);
+}
+
+void SBK_MAX72xxLinux::_writeColToAllDevices(uint8_t targetDevice, uint8_t colIdx, uint8_t data)
+{
+    if (targetDevice >= _devsNum || colIdx >= maxColumns())
+        return;
+
+    uint8_t frame[16];
+    uint8_t *out = frame;
+    for (int8_t i = _devsNum - 1; i >= 0; i--)
+    {
+        bool target = (i == static_cast<int8_t>(targetDevice));
+        *out++ = target ? (OP_DIGIT0 + colIdx) : OP_NOOP;
+        *out++ = target ? data : 0;
+    }
+
+    _writeFrames(frame, 1);
+}
+
+void SBK_MAX72xxLinux::_fillColToUpdatedDevices(uint8_t colIdx, uint8_t *frame)
+{
+    // One frame refreshes this digit on every updated device; unchanged devices get a NOOP
+    for (int8_t i = _devsNum - 1; i >= 0; i--)
+    {
+        if (_update[i])
+        {
+            *frame++ = OP_DIGIT0 + colIdx;
+            *frame++ = _buffer[_colIndex(i, colIdx)];
+        }
+        else
+        {
+            *frame++ = OP_NOOP;
+            *frame++ = 0;
+        }
+    }
+}
+
+void SBK_MAX72xxLinux::_writeFrames(const uint8_t *frames, uint8_t framesNum)
+{
+    if (_fake)
+    {
+        // Shift and latch each frame through the simulated chain, CS toggling between frames
+        for (uint8_t f = 0; f < framesNum; f++, frames += _frameBytes())
+            _fakeChain->frame(frames, _frameBytes());
+        _ioctlCount++;
+        return;
+    }
+
+    if (_spiFd < 0)
+        return;
+
+    struct spi_ioc_transfer xfer[_defaultColBufferSize];
+    memset(xfer, 0, sizeof(xfer));
+    for (uint8_t f = 0; f < framesNum; f++)
+    {
+        xfer[f].tx_buf = reinterpret_cast<uintptr_t>(frames + f * _frameBytes());
+        xfer[f].len = _frameBytes();
+        xfer[f].speed_hz = _spiClock;
+        xfer[f].bits_per_word = 8;
+        xfer[f].cs_change = (f + 1 < framesNum); // Release CS between frames to latch them
+    }
+
+    if (_csFd < 0)
+    {
+        // Controller CS: the whole batch in a single syscall
+        ioctl(_spiFd, SPI_IOC_MESSAGE(framesNum), xfer);
+        _ioctlCount++;
+        return;
+    }
+
+    // GPIO CS can't toggle inside a message: one ioctl per frame
+    for (uint8_t f = 0; f < framesNum; f++)
+    {
+        xfer[f].cs_change = 0;
+        _setCs(false);
+        ioctl(_spiFd, SPI_IOC_MESSAGE(1), &xfer[f]);
+        _setCs(true);
+        _ioctlCount++;
+    }
+}
+
+void SBK_MAX72xxLinux::_setCs(bool level)
+{
+    struct gpio_v2_line_values values;
+    values.bits = level ? 1 : 0;
+    values.mask = 1;
+    ioctl(_csFd, GPIO_V2_LINE_SET_VALUES_IOCTL, &values);
+}
+
+bool SBK_MAX72xxLinux::_anyUpdate() const
+{
+    for (uint8_t devIdx = 0; devIdx < _devsNum; devIdx++)
+    {
+        if (_update[devIdx])
+            return true;
+    }
+    return false;
+}
+
+inline uint8_t SBK_MAX72xxLinux::_bitMaskRow(uint8_t devIdx, uint8_t rowIdx) const
+{
+    (void)devIdx;
+    return SBK_MAX72xxRowMask[rowIdx]; // Same as 1 << (maxRows() - 1 - rowIdx), without the shift loop on AVR
+}
+
+inline uint8_t SBK_MAX72xxLinux::_colIndex(uint8_t devIdx, uint8_t colIdx) const
+{
+    return devIdx * _defaultColBufferSize + colIdx;
+}
+
+#endif // __linux__ && !ARDUINO
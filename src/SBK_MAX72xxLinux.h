@@ -0,0 +1,428 @@
+/**
+ * @file SBK_MAX72xxLinux.h
+ * @brief Linux userspace driver (spidev + GPIO character device) for MAX7219/MAX7221 LED matrix chips.
+ *
+ * Part of the SBK_MAX72xx Arduino Library.
+ * Lets the same driver API run on Linux single-board computers: frames go through
+ * /dev/spidevB.C, chip select is either the SPI controller's own CS or a GPIO line
+ * driven through /dev/gpiochipN. A fake-device mode shifts frames through the chain
+ * simulator (SBK_MAX72xxChainSim) so code using the driver can run on any Linux box.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ *
+ * @version 2.0.4
+ *
+ * @license MIT
+ *
+ * @copyright
+ * Copyright (c) 2025 Samuel Barabé
+ *
+ * Repository: https://github.com/sbarabe/SBK_MAX72xx
+ */
+
+#pragma once
+
+#define SBK_MAX72xx_IS_DEFINED
+
+#if !defined(__linux__) || defined(ARDUINO)
+#error "SBK_MAX72xxLinux is for Linux userspace builds only. Use SBK_MAX72xxHard or SBK_MAX72xxSoft on Arduino."
+#endif
+
+#include <stdint.h>
+#include "SBK_MAX72xxChainSim.h"
+#include "SBK_MAX72xxFast.h"
+
+/**
+ * @class SBK_MAX72xxLinux
+ * @brief Controls multiple MAX7219/MAX7221 LED drivers from Linux userspace.
+ *
+ * With the SPI controller's own CS, show() sends every digit frame in a single batched
+ * SPI_IOC_MESSAGE ioctl (CS toggles between transfers). With a GPIO chip select, each
+ * frame is one ioctl framed by two GPIO line updates.
+ */
+class SBK_MAX72xxLinux
+{
+public:
+    /**
+     * @brief Construct a new Linux spidev SBK_MAX72xxLinux driver instance.
+     *
+     * @param spiDevice    spidev node, e.g. "/dev/spidev0.0".
+     * @param devsNum      Number of daisy-chained MAX72xx devices. Default is 1.
+     * @param gpioChip     GPIO chip node driving CS, e.g. "/dev/gpiochip0", or nullptr to
+     *                     use the SPI controller's own chip select (default).
+     * @param csLine       Line offset of the CS pin on @p gpioChip.
+     *
+     * Initializes internal display buffer for each device in the chain.
+     * Each device reserves 8 bytes — one for each digit line (DIG0–DIG7), representing columns (cathode outputs).
+     * @note Each byte in the buffer holds segment (SEG0–SEG7) values for one column.
+     */
+    SBK_MAX72xxLinux(const char *spiDevice, uint8_t devsNum = 1, const char *gpioChip = nullptr, uint32_t csLine = 0);
+
+    /**
+     * @brief Construct a fake-device driver instance.
+     *
+     * @param devsNum Number of simulated daisy-chained MAX72xx devices.
+     *
+     * No device node is opened: every frame is shifted through a SBK_MAX72xxChainSim and
+     * latched exactly as a real chain would decode it (see fakeChain() and fakeRegister()).
+     */
+    explicit SBK_MAX72xxLinux(uint8_t devsNum);
+
+    /**
+     * @brief Set SPI clock speed. Call before begin().
+     * @param frequency Frequency in Hz (e.g., 1000000 for 1 MHz, MAX7219 max is 10 MHz).
+     */
+    void setSPIClock(uint32_t frequency);
+
+    /**
+     * @brief Close the SPI and GPIO file descriptors.
+     */
+    void end();
+
+    /**
+     * @brief Check that begin() managed to open and configure the devices.
+     *
+     * @return true once begin() succeeded (always true in fake-device mode).
+     */
+    bool ready() const { return _fake || _spiFd >= 0; }
+
+    /**
+     * @brief Read a register as latched by a simulated device (fake-device mode only).
+     *
+     * @param devIdx Target device index.
+     * @param opcode Register address (0x01–0x08 digits, 0x09–0x0C, 0x0F).
+     * @return Last value written to that register, 0 if never written or not in fake-device mode.
+     */
+    uint8_t fakeRegister(uint8_t devIdx, uint8_t opcode) const;
+
+    /**
+     * @brief Simulated chain of the fake-device mode, nullptr for a real device.
+     */
+    const SBK_MAX72xxChainSim *fakeChain() const { return _fakeChain; }
+
+    /**
+     * @brief Number of SPI transfer ioctls issued (or simulated) since construction.
+     */
+    uint32_t ioctlCount() const { return _ioctlCount; }
+
+    ~SBK_MAX72xxLinux(); // Destructor
+
+    /**
+     * @brief Returns the number of addressable row lines (anode outputs = SEGx).
+     *
+     * @param devIdx Index of the target device (0-based in daisy chain).
+     *               This parameter is ignored for MAX7219/7221 chips,
+     *               but included for API compatibility with SBK_BarDrive.
+     *
+     * For MAX7219/7221 drivers, this value is always 8, since each column (DIGx)
+     * can display up to 8 vertical segments connected to SEG0–SEG7 (anode lines).
+     *
+     * @return Number of row lines (SEGx/anodes), always 8 for MAX72xx devices.
+     */
+    uint8_t maxRows(uint8_t devIdx = 0) const
+    {
+        (void)devIdx;
+        return _defaultRowBufferSize;
+    }
+
+    /**
+     * @brief Returns the number of addressable columns (cathode outputs = DIGx).
+     *
+     * This is a fixed value of 8 for MAX7219/7221, since each digit line (DIG0–DIG7) selects one column (cathode).
+     * Each DIGx line maps to one 8-bit buffer entry representing the vertical SEGx lines.
+     *
+     * @return Number of columns (DIGx = cathode outputs), always 8.
+     */
+    uint8_t maxColumns() const { return _defaultColBufferSize; }
+
+    /**
+     * @brief Returns the total number of addressable LED segments for this device.
+     *
+     * @param devIdx Index of the target device (0-based in daisy chain).
+     *               This parameter is ignored for MAX7219/7221 chips,
+     *               but is included for API compatibility with SBK_BarDrive.
+     *
+     * This value is computed as:
+     * `maxRows(devIdx) × maxColumns()`
+     * For MAX7219/7221, this is always 8 × 8 = 64 segments per device.
+     *
+     * @return Total number of addressable LED segments (pixels) for this device.
+     */
+    uint8_t maxSegments(uint8_t devIdx = 0) const { return maxRows(devIdx) * maxColumns(); }
+
+    /**
+     * @brief Open and configure the spidev and GPIO devices, then initialize all MAX72xx chips.
+     */
+    void begin();
+
+    /**
+     * @brief Enable or disable shutdown mode on a specific device.
+     *
+     * @param devIdx Index of the target device.
+     * @param status false = shutdown, true = normal operation
+     */
+    void setShutdown(uint8_t devIdx, bool status);
+
+    /**
+     * @brief Set the scan limit (number of active digits) for a specific device.
+     *
+     * @param devIdx Target device index.
+     * @param limit  Value from 0 to 7.
+     */
+    void setScanLimit(uint8_t devIdx, uint8_t limit);
+
+    /**
+     * @brief Set the BCD Code-B decode mode of a specific device.
+     *
+     * @param devIdx Target device index.
+     * @param mask   One bit per digit (bit n = DIGn): 1 = Code-B, 0 = no decode (default).
+     *
+     * Digits in Code-B mode show the low nibble of their buffer byte as 0–9, '-', 'E',
+     * 'H', 'L', 'P' or blank, and bit 7 as the decimal point.
+     */
+    void setDecodeMode(uint8_t devIdx, uint8_t mask);
+
+    /**
+     * @brief Set display brightness for a specific device.
+     *
+     * @param devIdx Target device index.
+     * @param brightness Value from 0 (min) to 15 (max).
+     */
+    void setBrightness(uint8_t devIdx, uint8_t brightness);
+
+    /**
+     * @brief Set the brightness of every device with a single chain frame.
+     *
+     * @param levels One value per device, 0 (min) to 15 (max), device 0 first.
+     */
+    void setBrightness(const uint8_t *levels);
+
+    /**
+     * @brief Return the number of actives driver devices.
+     *
+     * @return number of actives driver devices.
+     */
+    uint8_t devsNum() const { return _devsNum; }
+
+    /**
+     * @brief Clear display buffer and hardware for one device.
+     *
+     * @param devIdx Target device index.
+     */
+    void clear(uint8_t devIdx);
+
+    /**
+     * @brief Clear display buffers and hardware for all devices.
+     *
+     * The whole chain is cleared with 8 chain-wide frames (see show()).
+     */
+    void clear();
+
+    /**
+     * @brief Set the state of a specific LED in the device’s internal matrix buffer.
+     *
+     * @param devIdx    Index of the target device (0-based in daisy chain).
+     * @param rowIdx    Logical rowIdx index (0 to maxRows(_devIdx) - 1) — vertical position (anode).
+     * @param colIdx    Logical column index (0 to maxColumns() - 1) — horizontal position (cathode).
+     * @param state     true = LED ON, false = LED OFF.
+     *
+     * @note The coordinate system follows a standard [row, col] layout.
+     *       For MAX72xx drivers:
+     *         - row corresponds to SEGx (segment outputs, V+ source = anode)
+     *         - col corresponds to DIGx (digit selectors, GND sink = cathode)
+     *
+     * This function updates the internal buffer; call show() to apply changes to hardware.
+     */
+    void setLed(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx, bool state);
+
+    /**
+     * @brief Get the state of a specific LED in the device’s internal matrix buffer.
+     *
+     * This function reads the last known state of a given LED at the specified row and column
+     * on a target device. It does not access the physical display hardware, but instead reads from
+     * the internal RAM buffer used for batching updates.
+     *
+     * @note This function may not reflect real-time display contents unless `show()` has been called
+     * after `setLed()`. For animations or state-dependent logic, ensure consistency by calling `show()` regularly.
+     *
+     * @param devIdx Index of the target device (0-based).
+     * @param rowIdx Row index (0–7).
+     * @param colIdx Column index (0–7).
+     * @return true if the LED is currently set ON in the buffer, false if OFF or invalid.
+     *
+     * @note The coordinate system follows a standard [row, col] layout.
+     *       For MAX72xx drivers:
+     *         - row corresponds to SEGx (segment outputs, V+ source = anode)
+     *         - col corresponds to DIGx (digit selectors, GND sink = cathode)
+     */
+    bool getLed(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx) const;
+
+    /**
+     * @brief Read one column byte from the buffer.
+     *
+     * @param devIdx Index of the target device.
+     * @param colIdx Column number (0 to 7).
+     * @return Column byte (row 0 = MSB), 0 if out of range.
+     */
+    uint8_t getCol(uint8_t devIdx, uint8_t colIdx) const;
+
+    /**
+     * @brief Copy the 8 column bytes of one device from the buffer.
+     *
+     * @param devIdx   Index of the target device.
+     * @param out      Destination, 8 bytes.
+     * @param rowMajor false = column bytes as setCol() takes them; true = 8 row bytes
+     *                 (row 0 first, column 0 = MSB), via an 8x8 bit transpose.
+     */
+    void getFrame(uint8_t devIdx, uint8_t *out, bool rowMajor = false) const;
+
+    /**
+     * @brief Snapshot a run of columns across the chain.
+     *
+     * Columns are numbered chain-wide: x = devIdx × 8 + colIdx.
+     *
+     * @param x        First column.
+     * @param width    Number of columns, clipped to the end of the chain.
+     * @param out      Destination: @p width column bytes, or with @p rowMajor 8 rows of
+     *                 (width + 7) / 8 bytes each (leftmost column = MSB of the first byte).
+     * @param rowMajor Transpose to row-major as in getFrame().
+     * @return Number of columns copied.
+     */
+    uint16_t copyRegion(uint16_t x, uint16_t width, uint8_t *out, bool rowMajor = false) const;
+
+    /**
+     * @brief Set the entire col value for a specific device (buffer only).
+     *
+     * @param devIdx    Index of the target device.
+     * @param colIdx    Column number (0 to 7).
+     * @param value     8-bit value for the row.
+     */
+    void setCol(uint8_t devIdx, uint8_t colIdx, uint8_t value);
+
+    /**
+     * @brief Unchecked setLed() for inner drawing loops that already clip their coordinates.
+     *
+     * Same effect as setLed() without the three bounds checks. Out-of-range arguments are
+     * undefined behavior; build with `SBK_MAX72XX_DEBUG` to turn them into assertions.
+     */
+    void setLedFast(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx, bool state);
+
+    /**
+     * @brief Unchecked pixel toggle (see setLedFast()).
+     */
+    void togglePixel(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx);
+
+    /**
+     * @brief Unchecked horizontal run: set @p len pixels of row @p rowIdx from column @p colIdx.
+     *
+     * The span must stay on one device (colIdx + len <= maxColumns()). See setLedFast().
+     */
+    void writePixelSpan(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx, uint8_t len, bool state);
+
+    /**
+     * @brief Toggle one LED in the buffer.
+     *
+     * @param devIdx Index of the target device.
+     * @param rowIdx Row index (0–7).
+     * @param colIdx Column index (0–7).
+     */
+    void toggleLed(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx);
+
+    /**
+     * @brief Invert every LED of one device (buffer only).
+     *
+     * @param devIdx Index of the target device.
+     */
+    void invert(uint8_t devIdx);
+
+    /**
+     * @brief Invert every LED of the chain (buffer only), a 32-bit word at a time.
+     */
+    void invertAll();
+
+    /**
+     * @brief Write only the masked bits of a column (buffer only).
+     *
+     * @param devIdx Index of the target device.
+     * @param colIdx Column number (0 to 7).
+     * @param mask   Bits to change (row 0 = MSB).
+     * @param value  New values for the bits set in @p mask; other bits are ignored.
+     */
+    void writeMasked(uint8_t devIdx, uint8_t colIdx, uint8_t mask, uint8_t value);
+
+    /**
+     * @brief Push the internal display buffer to all connected devices.
+     *
+     * This flushes all buffered LED states to the physical hardware for every device
+     * managed by this driver instance. Use this after making multiple `setLed()` calls
+     * to apply the changes to the display.
+     *
+     * Typically used in split-device or multi-bar meter setups.
+     *
+     * All updated devices are refreshed together: each of the 8 digit registers is sent
+     * in a single chain-wide frame, with NOOPs for devices that did not change.
+     * With the SPI controller's chip select, all frames go out in one ioctl.
+     */
+    void show();
+
+    /**
+     * @brief Push the internal display buffer to a specific device.
+     *
+     * @param devIdx Index of the target device (0-based in the daisy chain).
+     *
+     * Only the specified device's display will be updated. Useful for optimized
+     * partial updates when only one device has changed.
+     *
+     * @note The driver must track changes correctly for this to be meaningful.
+     */
+    void show(uint8_t devIdx);
+
+     /**
+     * @brief Enable/disable display-test mode on all devices.
+     */
+    void testMode(bool enable)
+    {
+        for (uint8_t i = 0; i < _devsNum; i++)
+            testMode(i, enable);
+    }
+
+    /**
+     * @brief Enable or disable the MAX72xx display test mode.
+     *
+     * @param devIdx Target device index (0-based)
+     * @param enable true = enable test mode (all LEDs ON), false = disable
+     */
+    void testMode(uint8_t devIdx, bool enable);
+
+private:
+    void _spiTransfer(uint8_t targetDevice, uint8_t opcode, uint8_t data);
+    void _spiTransferAll(uint8_t opcode, const uint8_t *data, uint8_t mask = 0xFF);
+    void _writeColToAllDevices(uint8_t targetDevice, uint8_t colIdx, uint8_t data);
+    void _fillColToUpdatedDevices(uint8_t colIdx, uint8_t *frame);
+    void _writeFrames(const uint8_t *frames, uint8_t framesNum);
+    void _setCs(bool level);
+    bool _anyUpdate() const;
+    inline uint8_t _bitMaskRow(uint8_t devIdx, uint8_t rowIdx) const;
+    inline uint8_t _colIndex(uint8_t devIdx, uint8_t colIdx) const;
+    inline uint8_t _frameBytes() const { return _devsNum * 2; }
+
+    const char *_spiDevice = nullptr;
+    const char *_gpioChip = nullptr;
+    const uint32_t _csLine = 0;
+    const uint8_t _devsNum = 1;
+    const bool _fake = false;
+
+    static constexpr uint8_t _defaultRowBufferSize = 8;
+    static constexpr uint8_t _defaultColBufferSize = 8;
+    uint8_t *_buffer; // Internal display buffer
+    bool *_update;    // Array to track if data has changed per device
+
+    int _spiFd = -1;
+    int _csFd = -1;              // GPIO line request, -1 when the SPI controller drives CS
+    uint8_t *_txBuffer;          // One frame per digit register
+    SBK_MAX72xxChainSim *_fakeChain = nullptr; // Fake-device chain, nullptr for a real device
+    uint32_t _ioctlCount = 0;
+
+    uint32_t _spiClock = 1000000; // Default 1 MHz
+};
@@ -0,0 +1,567 @@
+/**
+ * @file SBK_MAX72xxParallel.cpp
+ * @brief Implementation of the SBK_MAX72xxParallel class for controlling MAX7219/MAX7221 LED drivers.
+ *
+ * Part of the SBK_MAX72xx Arduino Library.
+ *
+ * This file contains the method implementations for refreshing up to 16 chains of
+ * MAX7219/MAX7221 chips at once through the ESP32 i80 parallel bus (I2S/LCD peripheral + DMA).
+ * It compiles to nothing on targets without ESP-IDF 5 and an i80 LCD bus.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ *
+ * @version 2.0.4
+ *
+ * @license MIT
+ *
+ * Copyright (c) 2025 Samuel Barabé
+ */
+
+#if defined(ESP32)
+#include <esp_idf_version.h>
+#include <soc/soc_caps.h>
+#if ESP_IDF_VERSION_MAJOR >= 5 && SOC_LCD_I80_SUPPORTED
+
+#include "SBK_MAX72xxParallel.h"
+#include <esp_heap_caps.h>
+
+// MAX7219/MAX7221 Opcodes
+#define OP_NOOP 0x00
+#define OP_DIGIT0 0x01
+#define OP_DIGIT1 0x02
+#define OP_DIGIT2 0x03
+#define OP_DIGIT3 0x04
+#define OP_DIGIT4 0x05
+#define OP_DIGIT5 0x06
+#define OP_DIGIT6 0x07
+#define OP_DIGIT7 0x08
+#define OP_DECODEMODE 0x09
+#define OP_INTENSITY 0x0A
+#define OP_SCANLIMIT 0x0B
+#define OP_SHUTDOWN 0x0C
+#define OP_DISPLAYTEST 0x0F
+
+SBK_MAX72xxParallel::SBK_MAX72xxParallel(const uint8_t *dinPins,
+                                         uint8_t chainsNum,
+                                         uint8_t clkPin,
+                                         uint8_t csPin,
+                                         uint8_t dcPin,
+                                         uint8_t devsPerChain)
+    : _chainsNum(constrain(chainsNum, 1, SBK_MAX72xxBitstream::maxChains)),
+      _clkPin(clkPin),
+      _csPin(csPin),
+      _dcPin(dcPin),
+      _devsPerChain(constrain(devsPerChain, 1, 8)),
+      _devsNum(_chainsNum * _devsPerChain)
+{
+    for (uint8_t i = 0; i < _busWidth(); i++)
+        _dinPins[i] = dinPins[i];
+
+    _buffer = new uint8_t[_devsNum * _defaultColBufferSize];
+    _update = new bool[_devsNum]();
+    memset(_buffer, 0, _devsNum * _defaultColBufferSize);
+
+    _frames = new uint8_t[_chainsNum * _frameBytes()];
+    _words = new uint16_t[SBK_MAX72xxBitstream::wordsPerFrame(_frameBytes())];
+}
+
+void SBK_MAX72xxParallel::setSPIClock(uint32_t frequency)
+{
+    _spiClock = frequency;
+}
+
+void SBK_MAX72xxParallel::end()
+{
+    waitIdle();
+
+    if (_io)
+    {
+        esp_lcd_panel_io_del(_io);
+        _io = nullptr;
+    }
+    if (_bus)
+    {
+        esp_lcd_del_i80_bus(_bus);
+        _bus = nullptr;
+    }
+}
+
+SBK_MAX72xxParallel::~SBK_MAX72xxParallel()
+{
+    end();
+
+    // Release the dynamically allocated memory
+    heap_caps_free(_dmaBuffer);
+    delete[] _words;
+    delete[] _frames;
+    delete[] _buffer;
+    delete[] _update;
+}
+
+void SBK_MAX72xxParallel::begin()
+{
+    const size_t slotBytes = SBK_MAX72xxBitstream::wordsPerFrame(_frameBytes()) * (_busWidth() / 8);
+
+    // DMA can only read from internal, DMA-capable RAM
+    if (!_dmaBuffer)
+        _dmaBuffer = static_cast<uint8_t *>(heap_caps_malloc(maxColumns() * slotBytes, MALLOC_CAP_DMA));
+    if (!_dmaBuffer)
+        return;
+
+    if (!_bus)
+    {
+        esp_lcd_i80_bus_config_t busConfig = {};
+        busConfig.clk_src = LCD_CLK_SRC_DEFAULT;
+        busConfig.dc_gpio_num = _dcPin;
+        busConfig.wr_gpio_num = _clkPin; // WR strobe rises with stable data: the MAX72xx CLK
+        for (uint8_t i = 0; i < _busWidth(); i++)
+            busConfig.data_gpio_nums[i] = _dinPins[i];
+        busConfig.bus_width = _busWidth();
+        busConfig.max_transfer_bytes = slotBytes;
+
+        if (esp_lcd_new_i80_bus(&busConfig, &_bus) != ESP_OK)
+        {
+            _bus = nullptr;
+            return;
+        }
+    }
+
+    if (!_io)
+    {
+        esp_lcd_panel_io_i80_config_t ioConfig = {};
+        ioConfig.cs_gpio_num = _csPin; // CS rising edge latches each frame
+        ioConfig.pclk_hz = _spiClock;
+        ioConfig.trans_queue_depth = maxColumns(); // A full refresh fits in the queue
+        ioConfig.on_color_trans_done = _onTransDone;
+        ioConfig.user_ctx = this;
+        ioConfig.lcd_cmd_bits = 8;
+        ioConfig.lcd_param_bits = 8;
+        ioConfig.dc_levels.dc_data_level = 1;
+
+        if (esp_lcd_new_panel_io_i80(_bus, &ioConfig, &_io) != ESP_OK)
+        {
+            _io = nullptr;
+            return;
+        }
+    }
+    delay(50); // small stabilization delay
+
+    for (uint8_t i = 0; i < _devsNum; ++i)
+    {
+        setShutdown(i, false);             // Wake up
+        setScanLimit(i, maxColumns() - 1); // Display all 8 digits
+        _spiTransfer(i, OP_DECODEMODE, 0); // No decode
+        testMode(i, false);                // Ensure test mode is OFF
+        setBrightness(i, 8);               // Medium brightness
+    }
+    clear(); // One pass clears every chain
+}
+
+void SBK_MAX72xxParallel::setShutdown(uint8_t devIdx, bool status)
+{
+    _spiTransfer(devIdx, OP_SHUTDOWN, status ? 0 : 1);
+}
+
+void SBK_MAX72xxParallel::setScanLimit(uint8_t devIdx, uint8_t limit)
+{
+    _spiTransfer(devIdx, OP_SCANLIMIT, limit & 0x07);
+}
+
+void SBK_MAX72xxParallel::setDecodeMode(uint8_t devIdx, uint8_t mask)
+{
+    _spiTransfer(devIdx, OP_DECODEMODE, mask);
+}
+
+void SBK_MAX72xxParallel::setBrightness(uint8_t devIdx, uint8_t brightness)
+{
+    // constrain the brightness to a 4-bit number (0–15)
+    _spiTransfer(devIdx, OP_INTENSITY, brightness & 0x0F);
+}
+
+void SBK_MAX72xxParallel::setBrightness(const uint8_t *levels)
+{
+    if (!levels)
+        return;
+
+    // One frame: every device latches its own intensity at once
+    _spiTransferAll(OP_INTENSITY, levels, 0x0F);
+}
+
+void SBK_MAX72xxParallel::clear(uint8_t devIdx)
+{
+    if (devIdx >= _devsNum)
+        return;
+
+    _update[devIdx] = true; // Mark this device for update
+
+    for (uint8_t colIdx = 0; colIdx < maxColumns(); colIdx++)
+    {
+        _buffer[_colIndex(devIdx, colIdx)] = 0x00;
+        _spiTransfer(devIdx, OP_DIGIT0 + colIdx, 0x00);
+    }
+}
+
+void SBK_MAX72xxParallel::clear()
+{
+    // Zero every chain with 8 chain-packed frames
+    memset(_buffer, 0, _devsNum * _defaultColBufferSize);
+    for (uint8_t d = 0; d < _devsNum; d++)
+        _update[d] = true;
+
+    show();
+}
+
+void SBK_MAX72xxParallel::setLed(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx, bool state)
+{
+    if (devIdx >= _devsNum || rowIdx >= maxRows(devIdx) || colIdx >= maxColumns())
+        return;
+
+    uint8_t &val = _buffer[_colIndex(devIdx, colIdx)];
+    uint8_t prior = val;
+
+    if (state)
+        val |= _bitMaskRow(devIdx, rowIdx);
+    else
+        val &= ~_bitMaskRow(devIdx, rowIdx);
+
+    if (val != prior)
+        _update[devIdx] = true;
+}
+
+bool SBK_MAX72xxParallel::getLed(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx) const
+{
+    if (devIdx >= _devsNum || rowIdx >= maxRows(devIdx) || colIdx >= maxColumns())
+        return false;
+
+    return (_buffer[_colIndex(devIdx, colIdx)] & _bitMaskRow(devIdx, rowIdx)) != 0;
+}
+
+uint8_t SBK_MAX72xxParallel::getCol(uint8_t devIdx, uint8_t colIdx) const
+{
+    if (devIdx >= _devsNum || colIdx >= maxColumns())
+        return 0;
+
+    return _buffer[_colIndex(devIdx, colIdx)];
+}
+
+void SBK_MAX72xxParallel::getFrame(uint8_t devIdx, uint8_t *out, bool rowMajor) const
+{
+    if (devIdx >= _devsNum || !out)
+        return;
+
+    for (uint8_t colIdx = 0; colIdx < maxColumns(); colIdx++)
+        out[colIdx] = _buffer[_colIndex(devIdx, colIdx)];
+
+    if (rowMajor)
+        SBK_MAX72xxTranspose8x8(out, out);
+}
+
+uint16_t SBK_MAX72xxParallel::copyRegion(uint16_t x, uint16_t width, uint8_t *out, bool rowMajor) const
+{
+    const uint16_t colsNum = _devsNum * maxColumns();
+    if (!out || x >= colsNum)
+        return 0;
+
+    if (width > colsNum - x)
+        width = colsNum - x;
+
+    if (!rowMajor)
+    {
+        for (uint16_t i = 0; i < width; i++, x++)
+            out[i] = _buffer[_colIndex(x / maxColumns(), x % maxColumns())];
+        return width;
+    }
+
+    // Row-major: transpose one 8-column block at a time into 8 rows of stride bytes
+    const uint16_t stride = (width + 7) / 8;
+    for (uint16_t block = 0; block < stride; block++)
+    {
+        uint8_t cols[8] = {0};
+        for (uint8_t i = 0; i < 8 && block * 8 + i < width; i++)
+        {
+            uint16_t col = x + block * 8 + i;
+            cols[i] = _buffer[_colIndex(col / maxColumns(), col % maxColumns())];
+        }
+
+        SBK_MAX72xxTranspose8x8(cols, cols);
+        for (uint8_t rowIdx = 0; rowIdx < 8; rowIdx++)
+            out[rowIdx * stride + block] = cols[rowIdx];
+    }
+    return width;
+}
+
+void SBK_MAX72xxParallel::setCol(uint8_t devIdx, uint8_t colIdx, uint8_t value)
+{
+    if (devIdx >= _devsNum || colIdx >= maxColumns())
+        return;
+
+    if (_buffer[_colIndex(devIdx, colIdx)] != value)
+    {
+        _buffer[_colIndex(devIdx, colIdx)] = value;
+        _update[devIdx] = true; // Mark device for update
+    }
+}
+
+void SBK_MAX72xxParallel::setLedFast(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx, bool state)
+{
+    SBK_MAX72XX_ASSERT(devIdx < _devsNum && rowIdx < maxRows(devIdx) && colIdx < maxColumns());
+
+    uint8_t &val = _buffer[_colIndex(devIdx, colIdx)];
+    uint8_t next = state ? (val | SBK_MAX72xxRowMask[rowIdx]) : (val & ~SBK_MAX72xxRowMask[rowIdx]);
+
+    if (next != val)
+    {
+        val = next;
+        _update[devIdx] = true;
+    }
+}
+
+void SBK_MAX72xxParallel::togglePixel(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx)
+{
+    SBK_MAX72XX_ASSERT(devIdx < _devsNum && rowIdx < maxRows(devIdx) && colIdx < maxColumns());
+
+    _buffer[_colIndex(devIdx, colIdx)] ^= SBK_MAX72xxRowMask[rowIdx];
+    _update[devIdx] = true;
+}
+
+void SBK_MAX72xxParallel::writePixelSpan(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx, uint8_t len, bool state)
+{
+    SBK_MAX72XX_ASSERT(devIdx < _devsNum && rowIdx < maxRows(devIdx) && colIdx + len <= maxColumns());
+
+    const uint8_t mask = SBK_MAX72xxRowMask[rowIdx];
+    for (uint8_t end = colIdx + len; colIdx < end; colIdx++)
+    {
+        uint8_t &val = _buffer[_colIndex(devIdx, colIdx)];
+        uint8_t next = state ? (val | mask) : (val & ~mask);
+
+        if (next != val)
+        {
+            val = next;
+            _update[devIdx] = true;
+        }
+    }
+}
+
+void SBK_MAX72xxParallel::toggleLed(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx)
+{
+    if (devIdx >= _devsNum || rowIdx >= maxRows(devIdx) || colIdx >= maxColumns())
+        return;
+
+    _buffer[_colIndex(devIdx, colIdx)] ^= _bitMaskRow(devIdx, rowIdx);
+    _update[devIdx] = true;
+}
+
+void SBK_MAX72xxParallel::invert(uint8_t devIdx)
+{
+    if (devIdx >= _devsNum)
+        return;
+
+    for (uint8_t colIdx = 0; colIdx < maxColumns(); colIdx++)
+    {
+        _buffer[_colIndex(devIdx, colIdx)] ^= 0xFF;
+        _update[devIdx] = true;
+    }
+}
+
+void SBK_MAX72xxParallel::invertAll()
+{
+    SBK_MAX72xxXorPattern(_buffer, _devsNum * _defaultColBufferSize, 0xFF, 0xFF);
+    for (uint8_t devIdx = 0; devIdx < _devsNum; devIdx++)
+        _update[devIdx] = true;
+}
+
+void SBK_MAX72xxParallel::writeMasked(uint8_t devIdx, uint8_t colIdx, uint8_t mask, uint8_t value)
+{
+    if (devIdx >= _devsNum || colIdx >= maxColumns())
+        return;
+
+    uint8_t &val = _buffer[_colIndex(devIdx, colIdx)];
+    uint8_t next = (val & ~mask) | (value & mask);
+
+    if (next != val)
+    {
+        val = next;
+        _update[devIdx] = true;
+    }
+}
+
+void SBK_MAX72xxParallel::show()
+{
+    if (!_io || !_anyUpdate())
+        return;
+
+    waitIdle(); // _dmaBuffer may still be read by DMA
+
+    for (uint8_t colIdx = 0; colIdx < maxColumns(); colIdx++)
+    {
+        _queueColToUpdatedDevices(colIdx);
+    }
+
+    for (uint8_t devIdx = 0; devIdx < _devsNum; devIdx++)
+        _update[devIdx] = false;
+}
+
+void SBK_MAX72xxParallel::show(uint8_t devIdx)
+{
+    if (!_io || devIdx >= _devsNum || !_update[devIdx])
+        return;
+
+    waitIdle(); // _dmaBuffer may still be read by DMA
+
+    for (uint8_t colIdx = 0; colIdx < maxColumns(); colIdx++)
+    {
+        _queueColToAllDevices(devIdx, colIdx, _buffer[_colIndex(devIdx, colIdx)]);
+    }
+    _update[devIdx] = false;
+}
+
+void SBK_MAX72xxParallel::testMode(uint8_t devIdx, bool enable)
+{
+    if (devIdx >= _devsNum)
+        return;
+
+    // MAX7219 test mode uses register 0x0F
+    // value 1 = test ON (all segments), 0 = test OFF
+    _spiTransfer(devIdx, OP_DISPLAYTEST, enable ? 1 : 0);
+}
+
+void SBK_MAX72xxParallel::_spiTransfer(uint8_t targetDevice, uint8_t opcode, uint8_t data)
+{
+    if (targetDevice >= _devsNum || !_io)
+        return; // Prevent invalid access
+
+    waitIdle(); // Keep register writes ordered after queued frames
+
+    // Target device gets the opcode, every other device of every chain a NOOP
+    uint8_t *out = _frames;
+    for (uint8_t chainIdx = 0; chainIdx < _chainsNum; chainIdx++)
+    {
+        for (int8_t i = _devsPerChain - 1; i >= 0; i--)
+        {
+            bool target = (chainIdx * _devsPerChain + i == targetDevice);
+            *out++ = target ? opcode : OP_NOOP;
+            *out++ = target ? data : 0;
+        }
+    }
+
+    _queueFrames(0);
+    waitIdle();
+}
+
+void SBK_MAX72xxParallel::_spiTransferAll(uint8_t opcode, const uint8_t *data, uint8_t mask)
+{
+    if (!_io)
+        return; // Prevent invalid access
+
+    waitIdle(); // Keep register writes ordered after queued frames
+
+    // Every device of every chain gets the opcode with its own value, in one frame per chain
+    uint8_t *out = _frames;
+    for (uint8_t chainIdx = 0; chainIdx < _chainsNum; chainIdx++)
+    {
+        for (int8_t i = _devsPerChain - 1; i >= 0; i--)
+        {
+            *out++ = opcode;
+            *out++ = data[chainIdx * _devsPerChain + i] & mask;
+        }
+    }
+
+    _queueFrames(0);
+    waitIdle();
+}
+
+void SBK_MAX72xxParallel::_queueColToAllDevices(uint8_t targetDevice, uint8_t colIdx, uint8_t data)
+{
+    if (targetDevice >= _devsNum || colIdx >= maxColumns())
+        return;
+
+    uint8_t *out = _frames;
+    for (uint8_t chainIdx = 0; chainIdx < _chainsNum; chainIdx++)
+    {
+        for (int8_t i = _devsPerChain - 1; i >= 0; i--)
+        {
+            bool target = (chainIdx * _devsPerChain + i == targetDevice);
+            *out++ = target ? (OP_DIGIT0 + colIdx) : OP_NOOP;
+            *out++ = target ? data : 0;
+        }
+    }
+
+    _queueFrames(colIdx);
+}
+
+void SBK_MAX72xxParallel::_queueColToUpdatedDevices(uint8_t colIdx)
+{
+    if (colIdx >= maxColumns())
+        return;
+
+    // One frame per chain refreshes this digit on every updated device; unchanged devices get a NOOP
+    uint8_t *out = _frames;
+    for (uint8_t chainIdx = 0; chainIdx < _chainsNum; chainIdx++)
+    {
+        uint8_t firstDev = chainIdx * _devsPerChain;
+        for (int8_t i = _devsPerChain - 1; i >= 0; i--)
+        {
+            if (_update[firstDev + i])
+            {
+                *out++ = OP_DIGIT0 + colIdx;
+                *out++ = _buffer[_colIndex(firstDev + i, colIdx)];
+            }
+            else
+            {
+                *out++ = OP_NOOP;
+                *out++ = 0;
+            }
+        }
+    }
+
+    _queueFrames(colIdx);
+}
+
+void SBK_MAX72xxParallel::_queueFrames(uint8_t slot)
+{
+    const uint16_t wordsNum = SBK_MAX72xxBitstream::wordsPerFrame(_frameBytes());
+    SBK_MAX72xxBitstream::encode(_frames, _chainsNum, _frameBytes(), _words);
+
+    // Copy into the DMA slot at the bus width
+    size_t slotBytes = wordsNum * (_busWidth() / 8);
+    uint8_t *dma = _dmaBuffer + slot * slotBytes;
+    SBK_MAX72xxBitstream::pack(_words, wordsNum, _busWidth(), dma);
+
+    _inFlight++;
+    if (esp_lcd_panel_io_tx_color(_io, -1, dma, slotBytes) != ESP_OK) // -1: no command phase
+        _inFlight--;
+}
+
+bool SBK_MAX72xxParallel::_onTransDone(esp_lcd_panel_io_handle_t io, esp_lcd_panel_io_event_data_t *event, void *ctx)
+{
+    (void)io;
+    (void)event;
+    SBK_MAX72xxParallel *self = static_cast<SBK_MAX72xxParallel *>(ctx);
+    self->_inFlight--;
+    return false; // No task to wake
+}
+
+bool SBK_MAX72xxParallel::_anyUpdate() const
+{
+    for (uint8_t devIdx = 0; devIdx < _devsNum; devIdx++)
+    {
+        if (_update[devIdx])
+            return true;
+    }
+    return false;
+}
+
+inline uint8_t SBK_MAX72xxParallel::_bitMaskRow(uint8_t devIdx, uint8_t rowIdx) const
+{
+    (void)devIdx;
+    return SBK_MAX72xxRowMask[rowIdx]; // Same as 1 << (maxRows() - 1 - rowIdx), without the shift loop on AVR
+}
+
+inline uint16_t SBK_MAX72xxParallel::_colIndex(uint8_t devIdx, uint8_t colIdx) const
+{
+    return devIdx * _defaultColBufferSize + colIdx;
+}
+
+#endif // ESP_IDF_VERSION_MAJOR >= 5 && SOC_LCD_I80_SUPPORTED
+#endif // ESP32
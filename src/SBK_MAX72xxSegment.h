@@ -0,0 +1,332 @@
+/**
+ * @file SBK_MAX72xxSegment.h
+ * @brief Text on 7-segment digit modules: ASCII to segments, decimal point folding, scrolling.
+ *
+ * Part of the SBK_MAX72xx Arduino Library.
+ * Characters become segment bytes through a 96-entry flash table (printable ASCII), and a
+ * '.', ',' or ':' following a character lights that character's decimal point instead of
+ * taking a digit. Every digit byte goes through the driver's setCol(), which only marks the
+ * digits that changed, so show() sends one register write per changed digit: a scroll step
+ * costs the digits whose character actually moved. Digits can also run in the chip's Code-B
+ * decode mode, chosen automatically when the text only uses Code-B characters.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ *
+ * @version 2.0.4
+ *
+ * @license MIT
+ *
+ * @copyright
+ * Copyright (c) 2025 Samuel Barabé
+ *
+ * Repository: https://github.com/sbarabe/SBK_MAX72xx
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "SBK_MAX72xxFast.h"
+#include "SBK_MAX72xxFont.h"
+
+/**
+ * @brief Segment bytes for ASCII 0x20–0x7F, no-decode layout: bit 7 = DP, bits 6–0 = A–G.
+ *
+ * Letters use the closest 7-segment shape (some, like K, M, W or X, are approximations).
+ */
+static const uint8_t SBK_MAX72xxSevenSegment[96] PROGMEM = {
+    0x00, 0x30, 0x22, 0x37, 0x5B, 0x13, 0x6D, 0x02, // sp ! " # $ % & '
+    0x4E, 0x78, 0x37, 0x07, 0x10, 0x01, 0x00, 0x25, // ( ) * + , - . /
+    0x7E, 0x30, 0x6D, 0x79, 0x33, 0x5B, 0x5F, 0x70, // 0 1 2 3 4 5 6 7
+    0x7F, 0x7B, 0x00, 0x00, 0x09, 0x09, 0x18, 0x65, // 8 9 : ; < = > ?
+    0x7D, 0x77, 0x1F, 0x4E, 0x3D, 0x4F, 0x47, 0x5E, // @ A B C D E F G
+    0x37, 0x06, 0x3C, 0x37, 0x0E, 0x55, 0x15, 0x7E, // H I J K L M N O
+    0x67, 0x73, 0x05, 0x5B, 0x0F, 0x3E, 0x1C, 0x2A, // P Q R S T U V W
+    0x37, 0x3B, 0x6D, 0x4E, 0x13, 0x78, 0x62, 0x08, // X Y Z [ \ ] ^ _
+    0x20, 0x7D, 0x1F, 0x0D, 0x3D, 0x6F, 0x47, 0x7B, // ` a b c d e f g
+    0x17, 0x10, 0x38, 0x37, 0x06, 0x55, 0x15, 0x1D, // h i j k l m n o
+    0x67, 0x73, 0x05, 0x5B, 0x0F, 0x1C, 0x1C, 0x2A, // p q r s t u v w
+    0x37, 0x3B, 0x6D, 0x31, 0x06, 0x07, 0x40, 0x00  // x y z { | } ~ DEL
+};
+
+/**
+ * @brief Segment byte of an ASCII character (blank outside 0x20–0x7F).
+ */
+static inline uint8_t SBK_MAX72xxSegments(char c)
+{
+    uint8_t code = static_cast<uint8_t>(c);
+    return (code >= 0x20 && code < 0x80) ? SBK_MAX72xxReadFlash(SBK_MAX72xxSevenSegment + code - 0x20) : 0x00;
+}
+
+/**
+ * @brief Code-B value of an ASCII character (0–9, '-', E, H, L, P, blank), or 0xFF if it has none.
+ *
+ * Lowercase e, h, l, p map to their uppercase value for explicit Code-B printing; Auto
+ * mode does not treat them as Code-B characters.
+ */
+static inline uint8_t SBK_MAX72xxCodeB(char c)
+{
+    switch (c)
+    {
+    case '-':
+        return 0x0A;
+    case 'E':
+    case 'e':
+        return 0x0B;
+    case 'H':
+    case 'h':
+        return 0x0C;
+    case 'L':
+    case 'l':
+        return 0x0D;
+    case 'P':
+    case 'p':
+        return 0x0E;
+    case ' ':
+        return 0x0F;
+    default:
+        return (c >= '0' && c <= '9') ? c - '0' : 0xFF;
+    }
+}
+
+/**
+ * @brief How digit bytes are encoded.
+ */
+enum class SBK_MAX72xxDecodeMode : uint8_t
+{
+    NoDecode, ///< Segment bytes from the table, any character
+    CodeB,    ///< Code-B values; characters without one are blank
+    Auto      ///< Code-B while the text only has digits, '-', ' ', E, H, L, P; no decode otherwise
+};
+
+/**
+ * @class SBK_MAX72xxSegmentDisplay
+ * @brief Prints and scrolls text on a run of 7-segment digits.
+ *
+ * @tparam Driver   Any SBK_MAX72xx driver class (SBK_MAX72xxHard, SBK_MAX72xxSoft, ...).
+ * @tparam MaxChars Maximum characters of text kept, after decimal point folding.
+ *
+ * Digits are numbered from the left across the chain: digit p is on device p / 8. Most
+ * 8-digit modules wire DIG0 to the rightmost digit (@p reversed, the default).
+ * The display owns the decode mode register of its devices.
+ */
+template <typename Driver, uint8_t MaxChars = 32>
+class SBK_MAX72xxSegmentDisplay
+{
+public:
+    /**
+     * @param driver   Driver of the 7-segment modules.
+     * @param first    First digit used (0 = leftmost digit of device 0).
+     * @param digits   Number of digits used; 0 = all the digits from @p first to the end of the chain.
+     * @param reversed true if DIG0 is the rightmost digit of each module.
+     */
+    explicit SBK_MAX72xxSegmentDisplay(Driver &driver, uint16_t first = 0, uint16_t digits = 0, bool reversed = true)
+        : _driver(driver),
+          _first(first),
+          _digits(digits ? digits : driver.devsNum() * driver.maxColumns() - first),
+          _reversed(reversed)
+    {
+    }
+
+    /**
+     * @brief Number of digits driven.
+     */
+    uint16_t digits() const { return _digits; }
+
+    /**
+     * @brief Choose how digits are encoded; the decode registers follow on the next show().
+     */
+    void setDecodeMode(SBK_MAX72xxDecodeMode mode)
+    {
+        _mode = mode;
+        _render();
+    }
+
+    /**
+     * @brief Show @p text aligned in the digits (stops any scrolling).
+     *
+     * '.', ',' and ':' light the decimal point of the preceding character. Text wider than
+     * the display is cut: its end is kept with Right alignment, its start otherwise.
+     */
+    void print(const char *text, SBK_MAX72xxAlign align = SBK_MAX72xxAlign::Left)
+    {
+        _parse(text, align == SBK_MAX72xxAlign::Right);
+        _scrolling = false;
+
+        int16_t free = static_cast<int16_t>(_digits) - _len;
+        if (align == SBK_MAX72xxAlign::Right)
+            _offset = -free;
+        else if (align == SBK_MAX72xxAlign::Center)
+            _offset = free > 0 ? -(free / 2) : 0;
+        else
+            _offset = 0;
+        _render();
+    }
+
+    /**
+     * @brief Show an integer right-aligned (a convenience around print()).
+     *
+     * Not a print() overload: on AVR int32_t is long, and print(0) would be ambiguous
+     * between long and const char *.
+     */
+    void printNumber(int32_t value)
+    {
+        char text[12];
+        uint8_t i = sizeof(text);
+        text[--i] = '\0';
+        uint32_t magnitude = value < 0 ? 0 - static_cast<uint32_t>(value) : static_cast<uint32_t>(value);
+        do
+        {
+            text[--i] = '0' + magnitude % 10;
+            magnitude /= 10;
+        } while (magnitude);
+        if (value < 0)
+            text[--i] = '-';
+        print(text + i, SBK_MAX72xxAlign::Right);
+    }
+
+    /**
+     * @brief Set @p text to scroll from right to left; each scroll() moves it by one digit.
+     */
+    void setScrollText(const char *text)
+    {
+        _parse(text, false);
+        _scrolling = true;
+        _offset = -static_cast<int16_t>(_digits); // Starts just off the right edge
+        _render();
+    }
+
+    /**
+     * @brief Move scrolling text one digit to the left (buffer only).
+     *
+     * @return true when the text has fully left the display and starts over.
+     */
+    bool scroll()
+    {
+        if (!_scrolling)
+            return false;
+
+        bool wrapped = ++_offset >= _len;
+        if (wrapped)
+            _offset = -static_cast<int16_t>(_digits);
+        _render();
+        return wrapped;
+    }
+
+    /**
+     * @brief Push the changed digits, then any decode mode change, to the modules.
+     */
+    void show()
+    {
+        _driver.show();
+
+        // Digits are already encoded for the new mode, so switching it now shows them right
+        const bool codeB = _codeB();
+        if (codeB == _sentCodeB)
+            return;
+
+        const uint8_t devCols = _driver.maxColumns();
+        const uint16_t last = (_first + _digits - 1) / devCols;
+        for (uint16_t dev = _first / devCols; dev <= last && dev < _driver.devsNum(); dev++)
+            _driver.setDecodeMode(dev, codeB ? _devMask(dev) : 0x00);
+        _sentCodeB = codeB;
+    }
+
+private:
+    void _parse(const char *text, bool keepEnd)
+    {
+        _len = 0;
+        for (; text && *text; text++)
+        {
+            char c = *text;
+            bool dot = c == '.' || c == ',' || c == ':';
+            if (dot && _len && !(_text[_len - 1] & 0x80))
+            {
+                _text[_len - 1] |= 0x80; // Fold into the previous character
+                continue;
+            }
+            if (_len >= MaxChars)
+            {
+                if (!keepEnd)
+                    break;
+                for (uint8_t i = 1; i < _len; i++) // Keep the end: drop the first character
+                    _text[i - 1] = _text[i];
+                _len--;
+            }
+
+            if (dot)
+            {
+                _text[_len++] = ' ' | 0x80; // Leading or doubled dot: a blank digit with its DP
+                continue;
+            }
+            _text[_len++] = static_cast<uint8_t>(c) & 0x7F;
+        }
+
+        // Code-B only draws uppercase E, H, L, P: lowercase keeps its own glyph
+        _allCodeB = true;
+        for (uint8_t i = 0; i < _len && _allCodeB; i++)
+        {
+            char c = static_cast<char>(_text[i] & 0x7F);
+            _allCodeB = !(c >= 'a' && c <= 'z') && SBK_MAX72xxCodeB(c) != 0xFF;
+        }
+    }
+
+    bool _codeB() const
+    {
+        return _mode == SBK_MAX72xxDecodeMode::CodeB || (_mode == SBK_MAX72xxDecodeMode::Auto && _allCodeB);
+    }
+
+    uint8_t _devMask(uint8_t dev) const
+    {
+        // Digits of this device that belong to the display
+        const uint8_t devCols = _driver.maxColumns();
+        uint8_t mask = 0;
+        for (uint8_t d = 0; d < devCols; d++)
+        {
+            uint16_t p = dev * devCols + d;
+            if (p >= _first && p < _first + _digits)
+                mask |= 1 << (_reversed ? devCols - 1 - d : d);
+        }
+        return mask;
+    }
+
+    uint8_t _encode(uint8_t cell, bool codeB) const
+    {
+        const char c = static_cast<char>(cell & 0x7F);
+        const uint8_t dp = cell & 0x80;
+        if (!codeB)
+            return SBK_MAX72xxSegments(c) | dp;
+
+        uint8_t code = SBK_MAX72xxCodeB(c);
+        return (code == 0xFF ? 0x0F : code) | dp;
+    }
+
+    void _render()
+    {
+        const bool codeB = _codeB();
+        const uint8_t devCols = _driver.maxColumns();
+
+        for (uint16_t p = 0; p < _digits; p++)
+        {
+            int16_t i = _offset + static_cast<int16_t>(p);
+            uint8_t cell = (i >= 0 && i < _len) ? _text[i] : ' ';
+
+            uint16_t pos = _first + p;
+            uint8_t d = pos % devCols;
+            _driver.setCol(pos / devCols, _reversed ? devCols - 1 - d : d, _encode(cell, codeB));
+        }
+    }
+
+    Driver &_driver;
+    const uint16_t _first;
+    const uint16_t _digits;
+    const bool _reversed;
+
+    SBK_MAX72xxDecodeMode _mode = SBK_MAX72xxDecodeMode::NoDecode;
+    uint8_t _text[MaxChars] = {0}; // Characters, bit 7 = decimal point
+    uint8_t _len = 0;              // Characters in _text
+    int16_t _offset = 0;           // Character shown on the leftmost digit (negative = leading blanks)
+    bool _scrolling = false;
+    bool _allCodeB = true;         // Every character of the text has a Code-B value
+    bool _sentCodeB = false; // Decode mode of the modules (begin() sets no decode)
+};
@@ -43,6 +43,8 @@
 
 #include <Arduino.h>
 #include <SPI.h>
+#include "SBK_MAX72xxCapture.h"
+#include "SBK_MAX72xxFast.h"
 
 /**
  * @class SBK_MAX72xxSoft
@@ -132,6 +134,17 @@ public:
      */
     void setScanLimit(uint8_t devIdx, uint8_t limit);
 
+    /**
+     * @brief Set the BCD Code-B decode mode of a specific device.
+     *
+     * @param devIdx Target device index.
+     * @param mask   One bit per digit (bit n = DIGn): 1 = Code-B, 0 = no decode (default).
+     *
+     * Digits in Code-B mode show the low nibble of their buffer byte as 0–9, '-', 'E',
+     * 'H', 'L', 'P' or blank, and bit 7 as the decimal point.
+     */
+    void setDecodeMode(uint8_t devIdx, uint8_t mask);
+
     /**
      * @brief Set display brightness for a specific device.
      *
@@ -140,6 +153,13 @@ public:
      */
     void setBrightness(uint8_t devIdx, uint8_t brightness);
 
+    /**
+     * @brief Set the brightness of every device with a single chain frame.
+     *
+     * @param levels One value per device, 0 (min) to 15 (max), device 0 first.
+     */
+    void setBrightness(const uint8_t *levels);
+
     /**
      * @brief Return the number of actives driver devices.
      *
@@ -156,6 +176,8 @@ public:
 
     /**
      * @brief Clear display buffers and hardware for all devices.
+     *
+     * The whole chain is cleared with 8 chain-wide frames (see show()).
      */
     void clear();
 
@@ -198,6 +220,39 @@ public:
      */
     bool getLed(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx) const;
 
+    /**
+     * @brief Read one column byte from the buffer.
+     *
+     * @param devIdx Index of the target device.
+     * @param colIdx Column number (0 to 7).
+     * @return Column byte (row 0 = MSB), 0 if out of range.
+     */
+    uint8_t getCol(uint8_t devIdx, uint8_t colIdx) const;
+
+    /**
+     * @brief Copy the 8 column bytes of one device from the buffer.
+     *
+     * @param devIdx   Index of the target device.
+     * @param out      Destination, 8 bytes.
+     * @param rowMajor false = column bytes as setCol() takes them; true = 8 row bytes
+     *                 (row 0 first, column 0 = MSB), via an 8x8 bit transpose.
+     */
+    void getFrame(uint8_t devIdx, uint8_t *out, bool rowMajor = false) const;
+
+    /**
+     * @brief Snapshot a run of columns across the chain.
+     *
+     * Columns are numbered chain-wide: x = devIdx × 8 + colIdx.
+     *
+     * @param x        First column.
+     * @param width    Number of columns, clipped to the end of the chain.
+     * @param out      Destination: @p width column bytes, or with @p rowMajor 8 rows of
+     *                 (width + 7) / 8 bytes each (leftmost column = MSB of the first byte).
+     * @param rowMajor Transpose to row-major as in getFrame().
+     * @return Number of columns copied.
+     */
+    uint16_t copyRegion(uint16_t x, uint16_t width, uint8_t *out, bool rowMajor = false) const;
+
     /**
      * @brief Set the entire col value for a specific device (buffer only).
      *
@@ -207,6 +262,57 @@ public:
      */
     void setCol(uint8_t devIdx, uint8_t colIdx, uint8_t value);
 
+    /**
+     * @brief Unchecked setLed() for inner drawing loops that already clip their coordinates.
+     *
+     * Same effect as setLed() without the three bounds checks. Out-of-range arguments are
+     * undefined behavior; build with `SBK_MAX72XX_DEBUG` to turn them into assertions.
+     */
+    void setLedFast(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx, bool state);
+
+    /**
+     * @brief Unchecked pixel toggle (see setLedFast()).
+     */
+    void togglePixel(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx);
+
+    /**
+     * @brief Unchecked horizontal run: set @p len pixels of row @p rowIdx from column @p colIdx.
+     *
+     * The span must stay on one device (colIdx + len <= maxColumns()). See setLedFast().
+     */
+    void writePixelSpan(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx, uint8_t len, bool state);
+
+    /**
+     * @brief Toggle one LED in the buffer.
+     *
+     * @param devIdx Index of the target device.
+     * @param rowIdx Row index (0–7).
+     * @param colIdx Column index (0–7).
+     */
+    void toggleLed(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx);
+
+    /**
+     * @brief Invert every LED of one device (buffer only).
+     *
+     * @param devIdx Index of the target device.
+     */
+    void invert(uint8_t devIdx);
+
+    /**
+     * @brief Invert every LED of the chain (buffer only), a 32-bit word at a time.
+     */
+    void invertAll();
+
+    /**
+     * @brief Write only the masked bits of a column (buffer only).
+     *
+     * @param devIdx Index of the target device.
+     * @param colIdx Column number (0 to 7).
+     * @param mask   Bits to change (row 0 = MSB).
+     * @param value  New values for the bits set in @p mask; other bits are ignored.
+     */
+    void writeMasked(uint8_t devIdx, uint8_t colIdx, uint8_t mask, uint8_t value);
+
     /**
      * @brief Push the internal display buffer to all connected devices.
      *
@@ -215,6 +321,13 @@ public:
      * to apply the changes to the display.
      *
      * Typically used in split-device or multi-bar meter setups.
+     *
+     * Each digit register is kept as a ready-to-send chain-wide frame that `setLed()` and
+     * `setCol()` update in place; show() only pushes the frames of digits that changed.
+     * Devices that did not change simply get their current value again.
+     * Build the library with `SBK_MAX72XX_REFERENCE_FLUSH` defined (e.g. PlatformIO
+     * `build_flags`) to fall back to the original one-device-at-a-time flush
+     * (8 frames per updated device), e.g. to compare on-wire output.
      */
     void show();
 
@@ -247,11 +360,28 @@ public:
      */
     void testMode(uint8_t devIdx, bool enable);
 
+    /**
+     * @brief Record every SPI frame sent by this driver.
+     *
+     * @param capture Capture to feed (see SBK_MAX72xxCapture), or nullptr to stop recording.
+     *
+     * The capture must outlive the driver or be detached before it is destroyed.
+     */
+    void setCapture(SBK_MAX72xxCapture *capture) { _capture = capture; }
+
 private:
     void _spiTransfer(uint8_t targetDevice, uint8_t opcode, uint8_t data);
+    void _spiTransferAll(uint8_t opcode, const uint8_t *data, uint8_t mask = 0xFF);
     void _writeColToAllDevices(uint8_t targetDevice, uint8_t colIdx, uint8_t data);
+    void _writeFrame(const uint8_t *frame);
+    inline void _markCol(uint8_t devIdx, uint8_t colIdx);
+    inline void _beginFrame();
+    inline void _shiftByte(uint8_t data);
+    inline void _endFrame();
     inline uint8_t _bitMaskRow(uint8_t devIdx, uint8_t rowIdx) const;
     inline uint8_t _colIndex(uint8_t devIdx, uint8_t colIdx) const;
+    inline uint8_t _frameIndex(uint8_t devIdx, uint8_t colIdx) const;
+    inline uint8_t _frameBytes() const { return _devsNum * 2; }
 
     const uint8_t _dataPin;
     const uint8_t _clkPin;
@@ -260,8 +390,12 @@ private:
 
     static constexpr uint8_t _defaultRowBufferSize = 8;
     static constexpr uint8_t _defaultColBufferSize = 8;
-    uint8_t *_buffer; // Internal display buffer
-    bool *_update;    // Array to track if data has changed per device
+    uint8_t *_buffer; // Internal display buffer (is _frames with SBK_MAX72XX_WIRE_ORDER_BUFFER)
+    uint8_t *_update; // Per device: bit c set when its digit c changed since it was last sent
+    uint8_t *_frames; // Wire-order digit frames (opcode/data pairs), kept in sync with _buffer
+    uint8_t _dirtyCols = 0; // Bit c set when digit frame c must be resent
+
+    SBK_MAX72xxCapture *_capture = nullptr; // Optional SPI frame recorder
 
     uint32_t _spiClock = 1000000; // Default 1 MHz
 };
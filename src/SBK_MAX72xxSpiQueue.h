@@ -0,0 +1,147 @@
+/**
+ * @file SBK_MAX72xxSpiQueue.h
+ * @brief Portable bookkeeping of queued SPI transactions: descriptor slots and frames in flight.
+ *
+ * Part of the SBK_MAX72xx Arduino Library.
+ * A queued transaction hands its descriptor to the SPI driver until the driver returns it
+ * as finished. The queue keeps a ring of descriptor slots and only reuses a slot after the
+ * transport has returned that exact descriptor, whatever the order of show(), busy() and
+ * waitIdle() calls. The hardware calls go through a Transport class, so the same logic runs
+ * against a mock on any host (see extras/test/spiQueue).
+ *
+ * A Transport provides:
+ *   - typedef Descriptor: one transaction descriptor;
+ *   - bool queue(Descriptor &d, const uint8_t *data, uint16_t len): start sending, d stays
+ *     owned by the transport until result() returns it;
+ *   - Descriptor *result(bool wait): next finished descriptor, nullptr if none (or on error);
+ *   - void transmit(const uint8_t *data, uint16_t len): blocking send with no queued work.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ *
+ * @version 2.0.4
+ *
+ * @license MIT
+ *
+ * @copyright
+ * Copyright (c) 2025 Samuel Barabé
+ *
+ * Repository: https://github.com/sbarabe/SBK_MAX72xx
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * @class SBK_MAX72xxSpiQueue
+ * @brief Ring of transaction descriptors over a Transport.
+ *
+ * @tparam Transport SPI transport (see file description).
+ * @tparam Slots     Descriptors, i.e. frames that can be in flight at once.
+ */
+template <typename Transport, uint8_t Slots = 8>
+class SBK_MAX72xxSpiQueue
+{
+public:
+    typedef typename Transport::Descriptor Descriptor;
+
+    explicit SBK_MAX72xxSpiQueue(Transport &transport) : _transport(transport) {}
+
+    /**
+     * @brief Queue one frame; @p frame must stay unchanged until it has been sent.
+     *
+     * Waits for the oldest frame when every descriptor is in flight.
+     *
+     * @return false if the transport refused the frame.
+     */
+    bool queue(const uint8_t *frame, uint16_t len)
+    {
+        // Never hand out a descriptor the transport still owns
+        while (_owned[_head])
+        {
+            if (!_collect(true))
+                _forget();
+        }
+
+        if (!_transport.queue(_slots[_head], frame, len))
+            return false;
+
+        _owned[_head] = true;
+        _head = (_head + 1) % Slots;
+        _inFlight++;
+        return true;
+    }
+
+    /**
+     * @brief Collect the frames already sent, without waiting.
+     *
+     * @return true while frames are still in flight.
+     */
+    bool busy()
+    {
+        while (_inFlight && _collect(false))
+        {
+        }
+        return _inFlight > 0;
+    }
+
+    /**
+     * @brief Block until every queued frame has been sent.
+     */
+    void waitIdle()
+    {
+        while (_inFlight)
+        {
+            if (!_collect(true))
+                _forget(); // Transport error: nothing more will come back
+        }
+    }
+
+    /**
+     * @brief Send one frame now, after the queued ones (blocking).
+     */
+    void transmit(const uint8_t *frame, uint16_t len)
+    {
+        waitIdle();
+        _transport.transmit(frame, len);
+    }
+
+    /**
+     * @brief Frames queued and not yet returned by the transport.
+     */
+    uint8_t inFlight() const { return _inFlight; }
+
+private:
+    bool _collect(bool wait)
+    {
+        Descriptor *done = _transport.result(wait);
+        if (!done)
+            return false;
+
+        // Release the slot of this exact descriptor
+        for (uint8_t s = 0; s < Slots; s++)
+        {
+            if (done == &_slots[s] && _owned[s])
+            {
+                _owned[s] = false;
+                _inFlight--;
+                break;
+            }
+        }
+        return true;
+    }
+
+    void _forget()
+    {
+        for (uint8_t s = 0; s < Slots; s++)
+            _owned[s] = false;
+        _inFlight = 0;
+    }
+
+    Transport &_transport;
+    Descriptor _slots[Slots] = {};
+    bool _owned[Slots] = {false}; // Slot handed to the transport and not returned yet
+    uint8_t _head = 0;            // Next slot to use (the oldest one once the ring is full)
+    uint8_t _inFlight = 0;
+};
@@ -0,0 +1,55 @@
+/**
+ * @file SBK_MAX72xxStarburst.cpp
+ * @brief Built-in 14- and 16-segment ASCII fonts for SBK_MAX72xxStarburstDisplay.
+ *
+ * Part of the SBK_MAX72xx Arduino Library.
+ *
+ * Printable ASCII (0x20–0x7E), one 16-bit segment word per character in the logical bit
+ * order documented in SBK_MAX72xxStarburst.h. Lowercase letters use the uppercase shapes.
+ * The 14-segment font is the 16-segment one with the split top and bottom bars joined.
+ * Stored in flash (PROGMEM).
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ *
+ * @version 2.0.4
+ *
+ * @license MIT
+ *
+ * Copyright (c) 2025 Samuel Barabé
+ */
+
+#include "SBK_MAX72xxStarburst.h"
+
+static const uint16_t starburst14Glyphs[95] PROGMEM = {
+    0x0000, 0x0200, 0x0220, 0x12CE, 0x12ED, 0x1EED, 0x2359, 0x0400, // sp ! " # $ % & '
+    0x2400, 0x0900, 0x3FC0, 0x12C0, 0x0800, 0x00C0, 0x0008, 0x0C00, // ( ) * + , - . /
+    0x0C3F, 0x0406, 0x00DB, 0x008F, 0x00E6, 0x00ED, 0x00FD, 0x0007, // 0 1 2 3 4 5 6 7
+    0x00FF, 0x00EF, 0x1200, 0x0A00, 0x2400, 0x00C8, 0x0900, 0x1083, // 8 9 : ; < = > ?
+    0x02BB, 0x00F7, 0x128F, 0x0039, 0x120F, 0x0079, 0x0071, 0x00BD, // @ A B C D E F G
+    0x00F6, 0x1209, 0x001E, 0x2470, 0x0038, 0x0536, 0x2136, 0x003F, // H I J K L M N O
+    0x00F3, 0x203F, 0x20F3, 0x00ED, 0x1201, 0x003E, 0x0C30, 0x2836, // P Q R S T U V W
+    0x2D00, 0x1500, 0x0C09, 0x1209, 0x2100, 0x1209, 0x2800, 0x0008, // X Y Z [ \ ] ^ _
+    0x0100, 0x00F7, 0x128F, 0x0039, 0x120F, 0x0079, 0x0071, 0x00BD, // ` a b c d e f g
+    0x00F6, 0x1209, 0x001E, 0x2470, 0x0038, 0x0536, 0x2136, 0x003F, // h i j k l m n o
+    0x00F3, 0x203F, 0x20F3, 0x00ED, 0x1201, 0x003E, 0x0C30, 0x2836, // p q r s t u v w
+    0x2D00, 0x1500, 0x0C09, 0x1249, 0x1200, 0x1289, 0x0001  // x y z { | } ~
+};
+
+static const uint16_t starburst16Glyphs[95] PROGMEM = {
+    0x0000, 0x0800, 0x0880, 0x4B3C, 0x4BBB, 0x7BA9, 0x8D71, 0x1000, // sp ! " # $ % & '
+    0x9000, 0x2400, 0xFF00, 0x4B00, 0x2000, 0x0300, 0x0010, 0x3000, // ( ) * + , - . /
+    0x30FF, 0x100C, 0x0377, 0x023F, 0x038C, 0x03BB, 0x03FB, 0x000F, // 0 1 2 3 4 5 6 7
+    0x03FF, 0x03BF, 0x4800, 0x2800, 0x9000, 0x0330, 0x2400, 0x4207, // 8 9 : ; < = > ?
+    0x0AF7, 0x03CF, 0x4A3F, 0x00F3, 0x483F, 0x01F3, 0x01C3, 0x02FB, // @ A B C D E F G
+    0x03CC, 0x4833, 0x007C, 0x91C0, 0x00F0, 0x14CC, 0x84CC, 0x00FF, // H I J K L M N O
+    0x03C7, 0x80FF, 0x83C7, 0x03BB, 0x4803, 0x00FC, 0x30C0, 0xA0CC, // P Q R S T U V W
+    0xB400, 0x5400, 0x3033, 0x4822, 0x8400, 0x4811, 0xA000, 0x0030, // X Y Z [ \ ] ^ _
+    0x0400, 0x03CF, 0x4A3F, 0x00F3, 0x483F, 0x01F3, 0x01C3, 0x02FB, // ` a b c d e f g
+    0x03CC, 0x4833, 0x007C, 0x91C0, 0x00F0, 0x14CC, 0x84CC, 0x00FF, // h i j k l m n o
+    0x03C7, 0x80FF, 0x83C7, 0x03BB, 0x4803, 0x00FC, 0x30C0, 0xA0CC, // p q r s t u v w
+    0xB400, 0x5400, 0x3033, 0x4922, 0x4800, 0x4A11, 0x0003  // x y z { | } ~
+};
+
+const SBK_MAX72xxStarburstFont SBK_MAX72xxStarburst14 = {starburst14Glyphs, 14};
+const SBK_MAX72xxStarburstFont SBK_MAX72xxStarburst16 = {starburst16Glyphs, 0xFF};
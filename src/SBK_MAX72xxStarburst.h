@@ -0,0 +1,262 @@
+/**
+ * @file SBK_MAX72xxStarburst.h
+ * @brief Text on 14- and 16-segment (starburst) displays wired to pairs of digit columns.
+ *
+ * Part of the SBK_MAX72xx Arduino Library.
+ * A starburst character needs up to 16 segments, so it uses two DIG columns: character c
+ * takes chain columns first + 2c and first + 2c + 1, which may sit on two devices. Glyphs
+ * are 16-bit segment words in flash in a fixed logical order; an optional wiring table
+ * moves each logical segment to the column bit it is soldered to. Each character slot
+ * remembers the word it shows and is only remapped and written when the word changes.
+ *
+ * Logical segment bits (A top, B/C right, D bottom, E/F left, G middle, H–M inner):
+ *
+ *   16-segment: 0 A1, 1 A2, 2 B, 3 C, 4 D1, 5 D2, 6 E, 7 F, 8 G1, 9 G2,
+ *               10 H, 11 I, 12 J, 13 K, 14 L, 15 M (no decimal point)
+ *   14-segment: 0 A, 1 B, 2 C, 3 D, 4 E, 5 F, 6 G1, 7 G2,
+ *               8 H, 9 I, 10 J, 11 K, 12 L, 13 M, 14 DP
+ *
+ *   H upper-left diagonal, I upper vertical, J upper-right diagonal,
+ *   K lower-left diagonal, L lower vertical, M lower-right diagonal.
+ *
+ * Without a wiring table, segment bit n is bit n of the column pair's 16-bit word: bits
+ * 0–7 in the first column, bits 8–15 in the second, bit 0 = row 7 (LSB) of the column byte.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ *
+ * @version 2.0.4
+ *
+ * @license MIT
+ *
+ * @copyright
+ * Copyright (c) 2025 Samuel Barabé
+ *
+ * Repository: https://github.com/sbarabe/SBK_MAX72xx
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "SBK_MAX72xxFast.h"
+#include "SBK_MAX72xxFont.h"
+
+/**
+ * @struct SBK_MAX72xxStarburstFont
+ * @brief Segment words for printable ASCII (0x20–0x7E) in flash.
+ */
+struct SBK_MAX72xxStarburstFont
+{
+    const uint16_t *glyphs; ///< 95 segment words in flash (PROGMEM), ' ' first
+    uint8_t dpBit;          ///< Logical bit of the decimal point, 0xFF if the display has none
+
+    /**
+     * @brief Segment word of ASCII character @p c (blank outside 0x20–0x7E).
+     */
+    uint16_t glyph(char c) const
+    {
+        uint8_t code = static_cast<uint8_t>(c);
+        return (code >= 0x20 && code < 0x7F) ? SBK_MAX72xxReadFlash16(glyphs + code - 0x20) : 0;
+    }
+};
+
+/// Built-in 14-segment font with decimal point (bit 14).
+extern const SBK_MAX72xxStarburstFont SBK_MAX72xxStarburst14;
+
+/// Built-in 16-segment font (split top and bottom bars, no decimal point).
+extern const SBK_MAX72xxStarburstFont SBK_MAX72xxStarburst16;
+
+/**
+ * @class SBK_MAX72xxStarburstDisplay
+ * @brief Prints text on starburst characters, writing only the characters that changed.
+ *
+ * @tparam Driver   Any SBK_MAX72xx driver class (SBK_MAX72xxHard, SBK_MAX72xxSoft, ...).
+ * @tparam MaxChars Maximum number of characters driven.
+ */
+template <typename Driver, uint8_t MaxChars = 16>
+class SBK_MAX72xxStarburstDisplay
+{
+public:
+    /**
+     * @param driver Driver of the MAX72xx pairs.
+     * @param font   Segment font (not copied).
+     * @param first  Chain-wide column (x = devIdx × 8 + colIdx) of the first character's first column.
+     * @param chars  Number of characters; 0 = as many as fit from @p first to the end of the chain.
+     */
+    SBK_MAX72xxStarburstDisplay(Driver &driver, const SBK_MAX72xxStarburstFont &font, uint16_t first = 0,
+                                uint8_t chars = 0)
+        : _driver(driver),
+          _font(&font),
+          _first(first)
+    {
+        const uint16_t columns = driver.devsNum() * driver.maxColumns();
+        uint16_t fit = first < columns ? (columns - first) / 2 : 0;
+        _chars = chars ? chars : fit;
+        if (_chars > fit)
+            _chars = fit;
+        if (_chars > MaxChars)
+            _chars = MaxChars;
+    }
+
+    /**
+     * @brief Number of characters driven.
+     */
+    uint8_t chars() const { return _chars; }
+
+    /**
+     * @brief Change the font; every character is redrawn on the next flush().
+     */
+    void setFont(const SBK_MAX72xxStarburstFont &font)
+    {
+        _font = &font;
+        invalidate();
+    }
+
+    /**
+     * @brief Describe how the segments are soldered.
+     *
+     * @param wiring 16 bytes (not copied): wiring[n] is the bit (0–15) of the column pair
+     *               word driving logical segment n, or nullptr for the identity.
+     */
+    void setWiring(const uint8_t *wiring)
+    {
+        _wiring = wiring;
+        invalidate();
+    }
+
+    /**
+     * @brief Show @p text aligned in the characters.
+     *
+     * With a decimal point font, '.', ',' and ':' light the point of the preceding character.
+     * Text wider than the display is cut: its end is kept with Right alignment, its start
+     * otherwise.
+     */
+    void print(const char *text, SBK_MAX72xxAlign align = SBK_MAX72xxAlign::Left)
+    {
+        uint16_t words[MaxChars];
+        uint8_t len = 0;
+        uint16_t dp = (_font->dpBit < 16) ? static_cast<uint16_t>(1u << _font->dpBit) : 0;
+        for (; text && *text; text++)
+        {
+            bool dot = *text == '.' || *text == ',' || *text == ':';
+            if (dot && dp && len && !(words[len - 1] & dp))
+            {
+                words[len - 1] |= dp; // Fold into the previous character, even the last one kept
+                continue;
+            }
+            if (len == MaxChars)
+            {
+                if (align != SBK_MAX72xxAlign::Right)
+                    break;
+                for (uint8_t i = 1; i < len; i++) // Keep the end: drop the first character
+                    words[i - 1] = words[i];
+                len--;
+            }
+            words[len++] = (dot && dp) ? dp : _font->glyph(*text);
+        }
+
+        // Position of words[0]; negative when characters are cut on the left
+        int16_t start = static_cast<int16_t>(_chars) - len;
+        if (align == SBK_MAX72xxAlign::Center)
+            start = start > 0 ? start / 2 : 0;
+        else if (align != SBK_MAX72xxAlign::Right)
+            start = 0;
+
+        for (uint8_t c = 0; c < _chars; c++)
+        {
+            int16_t i = c - start;
+            _want[c] = (i >= 0 && i < len) ? words[i] : 0;
+        }
+    }
+
+    /**
+     * @brief Show one character at position @p pos (0 = first).
+     */
+    void setChar(uint8_t pos, char c, bool dp = false)
+    {
+        if (pos >= _chars)
+            return;
+        _want[pos] = _font->glyph(c) | ((dp && _font->dpBit < 16) ? static_cast<uint16_t>(1u << _font->dpBit) : 0);
+    }
+
+    /**
+     * @brief Show a raw logical segment word at position @p pos.
+     */
+    void setSegments(uint8_t pos, uint16_t segments)
+    {
+        if (pos >= _chars)
+            return;
+        _want[pos] = segments;
+    }
+
+    /**
+     * @brief Forget what is displayed, so the next flush() writes every character (e.g. after clear()).
+     */
+    void invalidate() { _stale = true; }
+
+    /**
+     * @brief Write the characters that changed into the driver buffer (no SPI traffic).
+     *
+     * @return Number of characters written.
+     */
+    uint8_t flush()
+    {
+        uint8_t written = 0;
+        for (uint8_t c = 0; c < _chars; c++)
+        {
+            if (!_stale && _want[c] == _shown[c])
+                continue;
+
+            uint16_t word = _wire(_want[c]);
+            _put(_first + 2 * c, word & 0xFF);
+            _put(_first + 2 * c + 1, word >> 8);
+            _shown[c] = _want[c];
+            written++;
+        }
+        _stale = false;
+        return written;
+    }
+
+    /**
+     * @brief flush() then show() on the driver.
+     *
+     * @return Number of characters written.
+     */
+    uint8_t show()
+    {
+        uint8_t written = flush();
+        _driver.show();
+        return written;
+    }
+
+private:
+    uint16_t _wire(uint16_t segments) const
+    {
+        if (!_wiring)
+            return segments;
+
+        uint16_t word = 0;
+        for (uint8_t n = 0; segments; n++, segments >>= 1)
+        {
+            if (segments & 1)
+                word |= 1u << (_wiring[n] & 0x0F);
+        }
+        return word;
+    }
+
+    void _put(uint16_t x, uint8_t value)
+    {
+        const uint8_t devCols = _driver.maxColumns();
+        _driver.setCol(x / devCols, x % devCols, value);
+    }
+
+    Driver &_driver;
+    const SBK_MAX72xxStarburstFont *_font;
+    const uint16_t _first;
+    uint8_t _chars = 0;
+    const uint8_t *_wiring = nullptr; // Logical segment to column pair bit, nullptr = identity
+    bool _stale = true;               // Write every character on the next flush()
+
+    uint16_t _want[MaxChars] = {0};  // Segment words to display
+    uint16_t _shown[MaxChars] = {0}; // Segment words displayed
+};
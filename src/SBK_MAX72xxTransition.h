@@ -0,0 +1,278 @@
+/**
+ * @file SBK_MAX72xxTransition.h
+ * @brief Wipe, slide and dissolve transitions between two chain-wide frames.
+ *
+ * Part of the SBK_MAX72xx Arduino Library.
+ * Intermediate frames are built from whole column bytes: wipes switch a moving range of
+ * columns, slides are column offsets (horizontal) or byte shifts (vertical), and dissolves
+ * apply a precomputed random cell order as per-column masks. Each step only writes the
+ * columns that can change, and the driver only sends those whose byte actually changed,
+ * so a step costs little more than its SPI traffic and runs at the chain's refresh rate.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ *
+ * @version 2.0.4
+ *
+ * @license MIT
+ *
+ * @copyright
+ * Copyright (c) 2025 Samuel Barabé
+ *
+ * Repository: https://github.com/sbarabe/SBK_MAX72xx
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+#include "SBK_MAX72xxFast.h"
+
+/**
+ * @brief Transition styles. Directions name the way the new frame moves in.
+ */
+enum class SBK_MAX72xxTransitionType : uint8_t
+{
+    Cut,        ///< New frame at once
+    WipeRight,  ///< New frame uncovered from left to right
+    WipeLeft,   ///< New frame uncovered from right to left
+    SlideLeft,  ///< Both frames move left, new one enters from the right
+    SlideRight, ///< Both frames move right, new one enters from the left
+    SlideUp,    ///< Both frames move up, new one enters from the bottom
+    SlideDown,  ///< Both frames move down, new one enters from the top
+    Dissolve    ///< Pixels switch in a random order
+};
+
+/**
+ * @brief Random order of the 64 cells of an 8x8 tile for dissolves (cell = column × 8 + row).
+ */
+static const uint8_t SBK_MAX72xxDissolveOrder[64] PROGMEM = {
+    0x20, 0x04, 0x06, 0x0D, 0x2C, 0x2D, 0x29, 0x14, 0x38, 0x22, 0x12, 0x0F, 0x28, 0x3B, 0x36, 0x08,
+    0x32, 0x01, 0x1E, 0x15, 0x1D, 0x2F, 0x02, 0x16, 0x39, 0x1B, 0x10, 0x3C, 0x34, 0x3E, 0x3D, 0x0C,
+    0x23, 0x25, 0x00, 0x13, 0x3A, 0x03, 0x24, 0x1F, 0x26, 0x0A, 0x30, 0x2A, 0x0B, 0x09, 0x21, 0x31,
+    0x0E, 0x2B, 0x37, 0x11, 0x18, 0x3F, 0x1C, 0x35, 0x2E, 0x33, 0x1A, 0x05, 0x27, 0x17, 0x07, 0x19};
+
+/**
+ * @class SBK_MAX72xxTransition
+ * @brief Plays a transition between two frames of devsNum() × 8 column bytes.
+ *
+ * @tparam Driver Any SBK_MAX72xx driver class (SBK_MAX72xxHard, SBK_MAX72xxSoft, ...).
+ *
+ * Frames use chain-wide columns (x = devIdx × 8 + colIdx, row 0 = MSB), e.g. as filled by
+ * the driver's copyRegion(). They are read during the whole transition, not copied.
+ */
+template <typename Driver>
+class SBK_MAX72xxTransition
+{
+public:
+    /**
+     * @param driver Driver to play the transition on. Its devsNum() sets the frame width.
+     */
+    explicit SBK_MAX72xxTransition(Driver &driver)
+        : _driver(driver),
+          _width(driver.devsNum() * driver.maxColumns())
+    {
+    }
+
+    ~SBK_MAX72xxTransition()
+    {
+        // Release the dynamically allocated memory
+        delete[] _snapshot;
+    }
+
+    /**
+     * @brief Prepare a transition and put the starting frame in the driver buffer.
+     *
+     * @param from    Starting frame, or nullptr to start from what the driver buffer holds.
+     * @param to      Final frame.
+     * @param type    Transition style.
+     * @param steps   Number of frames shown, the last one being @p to (0 acts as 1).
+     * @param inFlash true if @p from and @p to are declared PROGMEM.
+     */
+    void start(const uint8_t *from, const uint8_t *to, SBK_MAX72xxTransitionType type, uint8_t steps,
+               bool inFlash = false)
+    {
+        if (!to)
+            return;
+
+        _from = from;
+        _inFlashFrom = from ? inFlash : false;
+        if (!_from)
+        {
+            // Snapshot the current content, allocated on first use
+            if (!_snapshot)
+                _snapshot = new uint8_t[_width];
+            _driver.copyRegion(0, _width, _snapshot);
+            _from = _snapshot;
+        }
+
+        _to = to;
+        _inFlashTo = inFlash;
+        _type = type;
+        _steps = steps ? steps : 1;
+        _step = 0;
+        _level = 0;
+        memset(_tile, 0, sizeof(_tile));
+
+        for (uint16_t x = 0; x < _width; x++)
+            _put(x, _fromCol(x));
+    }
+
+    /**
+     * @brief true until the last frame has been shown.
+     */
+    bool running() const { return _to && _step < _steps; }
+
+    /**
+     * @brief Compute and show the next frame.
+     *
+     * @return false (and does nothing) once the transition is over.
+     */
+    bool step()
+    {
+        if (!running())
+            return false;
+
+        _step++;
+        switch (_type)
+        {
+        case SBK_MAX72xxTransitionType::WipeRight:
+        case SBK_MAX72xxTransitionType::WipeLeft:
+            _wipe();
+            break;
+        case SBK_MAX72xxTransitionType::SlideLeft:
+        case SBK_MAX72xxTransitionType::SlideRight:
+            _slideH();
+            break;
+        case SBK_MAX72xxTransitionType::SlideUp:
+        case SBK_MAX72xxTransitionType::SlideDown:
+            _slideV();
+            break;
+        case SBK_MAX72xxTransitionType::Dissolve:
+            _dissolve();
+            break;
+        default:
+            _step = _steps; // Cut
+            for (uint16_t x = 0; x < _width; x++)
+                _put(x, _toCol(x));
+            break;
+        }
+
+        _driver.show();
+        return true;
+    }
+
+    /**
+     * @brief Play a whole transition, one frame after the other, as fast as the chain allows.
+     */
+    void transition(const uint8_t *from, const uint8_t *to, SBK_MAX72xxTransitionType type, uint8_t steps,
+                    bool inFlash = false)
+    {
+        start(from, to, type, steps, inFlash);
+        while (step())
+        {
+        }
+    }
+
+private:
+    uint8_t _fromCol(uint16_t x) const { return _inFlashFrom ? SBK_MAX72xxReadFlash(_from + x) : _from[x]; }
+    uint8_t _toCol(uint16_t x) const { return _inFlashTo ? SBK_MAX72xxReadFlash(_to + x) : _to[x]; }
+
+    void _put(uint16_t x, uint8_t value)
+    {
+        _driver.setCol(x / _driver.maxColumns(), x % _driver.maxColumns(), value);
+    }
+
+    uint16_t _progress(uint16_t range) const
+    {
+        return static_cast<uint32_t>(range) * _step / _steps;
+    }
+
+    void _wipe()
+    {
+        // Only the columns crossed since the last step change
+        uint16_t prev = static_cast<uint32_t>(_width) * (_step - 1) / _steps;
+        uint16_t pos = _progress(_width);
+
+        for (uint16_t i = prev; i < pos; i++)
+        {
+            uint16_t x = (_type == SBK_MAX72xxTransitionType::WipeRight) ? i : _width - 1 - i;
+            _put(x, _toCol(x));
+        }
+    }
+
+    void _slideH()
+    {
+        uint16_t offset = _progress(_width);
+
+        for (uint16_t x = 0; x < _width; x++)
+        {
+            uint8_t value;
+            if (_type == SBK_MAX72xxTransitionType::SlideLeft)
+                value = (x + offset < _width) ? _fromCol(x + offset) : _toCol(x + offset - _width);
+            else
+                value = (x < offset) ? _toCol(_width - offset + x) : _fromCol(x - offset);
+            _put(x, value);
+        }
+    }
+
+    void _slideV()
+    {
+        uint8_t shift = _progress(8);
+
+        for (uint16_t x = 0; x < _width; x++)
+        {
+            uint16_t from = _fromCol(x);
+            uint16_t to = _toCol(x);
+            uint8_t value = (_type == SBK_MAX72xxTransitionType::SlideUp)
+                                ? (from << shift) | (to >> (8 - shift))
+                                : (from >> shift) | (to << (8 - shift));
+            _put(x, value);
+        }
+    }
+
+    static uint8_t _rotate(uint8_t value, uint8_t n)
+    {
+        n &= 7;
+        return n ? static_cast<uint8_t>((value >> n) | (value << (8 - n))) : value;
+    }
+
+    void _dissolve()
+    {
+        // Add the tile cells ranked between the previous and the new level
+        uint8_t level = _progress(64);
+        uint8_t delta[8] = {0};
+        for (; _level < level; _level++)
+        {
+            uint8_t cell = SBK_MAX72xxReadFlash(SBK_MAX72xxDissolveOrder + _level);
+            delta[cell >> 3] |= SBK_MAX72xxRowMask[cell & 7];
+        }
+        for (uint8_t c = 0; c < 8; c++)
+            _tile[c] |= delta[c];
+
+        // Each device uses the tile with its rows rotated, so devices do not dissolve alike
+        for (uint16_t x = 0; x < _width; x++)
+        {
+            uint8_t rot = (x >> 3) * 3;
+            if (!_rotate(delta[x & 7], rot))
+                continue;
+
+            uint8_t mask = _rotate(_tile[x & 7], rot);
+            _put(x, (_fromCol(x) & ~mask) | (_toCol(x) & mask));
+        }
+    }
+
+    Driver &_driver;
+    const uint16_t _width;
+    uint8_t *_snapshot = nullptr; // Starting frame when start() gets nullptr, allocated on first use
+
+    const uint8_t *_from = nullptr;
+    const uint8_t *_to = nullptr;
+    bool _inFlashFrom = false; // _from is in flash
+    bool _inFlashTo = false;   // _to is in flash
+    SBK_MAX72xxTransitionType _type = SBK_MAX72xxTransitionType::Cut;
+    uint8_t _steps = 1;
+    uint8_t _step = 0;
+    uint8_t _level = 0;     // Dissolve: tile cells switched so far
+    uint8_t _tile[8] = {0}; // Dissolve: switched cells of the tile, per tile column
+};
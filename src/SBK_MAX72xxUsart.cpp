@@ -0,0 +1,658 @@
+/**
+ * @file SBK_MAX72xxUsart.cpp
+ * @brief Implementation of the SBK_MAX72xxUsart class for controlling MAX7219/MAX7221 LED drivers.
+ *
+ * Part of the SBK_MAX72xx Arduino Library.
+ *
+ * This file contains the method implementations for managing multiple daisy-chained
+ * MAX7219/MAX7221 chips through an AVR USART running in Master SPI mode (MSPIM).
+ * It compiles to nothing on non-AVR targets.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ *
+ * @version 2.0.4
+ *
+ * @license MIT
+ *
+ * Copyright (c) 2025 Samuel Barabé
+ */
+
+#if defined(__AVR__)
+
+#include "SBK_MAX72xxUsart.h"
+
+// MAX7219/MAX7221 Opcodes
+#define OP_NOOP 0x00
+#define OP_DIGIT0 0x01
+#define OP_DIGIT1 0x02
+#define OP_DIGIT2 0x03
+#define OP_DIGIT3 0x04
+#define OP_DIGIT4 0x05
+#define OP_DIGIT5 0x06
+#define OP_DIGIT6 0x07
+#define OP_DIGIT7 0x08
+#define OP_DECODEMODE 0x09
+#define OP_INTENSITY 0x0A
+#define OP_SCANLIMIT 0x0B
+#define OP_SHUTDOWN 0x0C
+#define OP_DISPLAYTEST 0x0F
+
+// USARTn register bits in MSPI mode (same positions for every USART)
+#define MSPI_TXC 6     // UCSRnA: transmit complete
+#define MSPI_UDRE 5    // UCSRnA: data register empty
+#define MSPI_TXCIE 6   // UCSRnB: transmit complete interrupt enable
+#define MSPI_UDRIE 5   // UCSRnB: data register empty interrupt enable
+#define MSPI_TXEN 3    // UCSRnB: transmitter enable
+#define MSPI_UMSEL1 7  // UCSRnC: UMSELn1:0 = 0b11 selects Master SPI mode,
+#define MSPI_UMSEL0 6  //         other bits 0 = MSB first, SPI mode 0
+
+SBK_MAX72xxUsart::SBK_MAX72xxUsart(uint8_t csPin,
+                                   uint8_t devsNum,
+                                   uint8_t usartNum)
+    : _csPin(csPin),
+      _devsNum(constrain(devsNum, 1, 8))
+{
+    _buffer = new uint8_t[_devsNum * _defaultColBufferSize];
+    _update = new bool[_devsNum]();
+    memset(_buffer, 0, _devsNum * _defaultColBufferSize);
+
+    // Pick the USARTn registers and its XCKn pin, which must be an output in master mode
+    switch (usartNum)
+    {
+#if defined(UBRR0)
+    case 0:
+        _ucsra = &UCSR0A;
+        _ucsrb = &UCSR0B;
+        _ucsrc = &UCSR0C;
+        _ubrr = &UBRR0;
+        _udr = &UDR0;
+#if defined(__AVR_ATmega328P__) || defined(__AVR_ATmega328PB__) || defined(__AVR_ATmega328__) || \
+    defined(__AVR_ATmega168__) || defined(__AVR_ATmega168PA__) || defined(__AVR_ATmega88__)
+        _xckDdr = &DDRD; // XCK0 = PD4 (D4)
+        _xckMask = _BV(4);
+#elif defined(__AVR_ATmega1280__) || defined(__AVR_ATmega2560__)
+        _xckDdr = &DDRE; // XCK0 = PE2
+        _xckMask = _BV(2);
+#elif defined(__AVR_ATmega644P__) || defined(__AVR_ATmega1284P__)
+        _xckDdr = &DDRB; // XCK0 = PB0
+        _xckMask = _BV(0);
+#endif
+        break;
+#endif
+#if defined(UBRR1)
+    case 1:
+        _ucsra = &UCSR1A;
+        _ucsrb = &UCSR1B;
+        _ucsrc = &UCSR1C;
+        _ubrr = &UBRR1;
+        _udr = &UDR1;
+#if defined(__AVR_ATmega1280__) || defined(__AVR_ATmega2560__) || defined(__AVR_ATmega32U4__)
+        _xckDdr = &DDRD; // XCK1 = PD5
+        _xckMask = _BV(5);
+#elif defined(__AVR_ATmega644P__) || defined(__AVR_ATmega1284P__)
+        _xckDdr = &DDRD; // XCK1 = PD4
+        _xckMask = _BV(4);
+#endif
+        break;
+#endif
+#if defined(UBRR2)
+    case 2:
+        _ucsra = &UCSR2A;
+        _ucsrb = &UCSR2B;
+        _ucsrc = &UCSR2C;
+        _ubrr = &UBRR2;
+        _udr = &UDR2;
+        _xckDdr = &DDRH; // XCK2 = PH2
+        _xckMask = _BV(2);
+        break;
+#endif
+#if defined(UBRR3)
+    case 3:
+        _ucsra = &UCSR3A;
+        _ucsrb = &UCSR3B;
+        _ucsrc = &UCSR3C;
+        _ubrr = &UBRR3;
+        _udr = &UDR3;
+        _xckDdr = &DDRJ; // XCK3 = PJ2
+        _xckMask = _BV(2);
+        break;
+#endif
+    default:
+        break; // Unsupported USART: every call below becomes a no-op
+    }
+}
+
+void SBK_MAX72xxUsart::setSPIClock(uint32_t frequency)
+{
+    _spiClock = frequency;
+}
+
+void SBK_MAX72xxUsart::end()
+{
+    waitIdle();
+
+    if (_ucsrb)
+        *_ucsrb = 0; // Disable transmitter and interrupts
+}
+
+SBK_MAX72xxUsart::~SBK_MAX72xxUsart()
+{
+    end();
+
+    // Release the dynamically allocated memory
+    delete[] _txBuffer;
+    delete[] _buffer;
+    delete[] _update;
+}
+
+void SBK_MAX72xxUsart::begin()
+{
+    if (!_udr || !_xckDdr)
+        return;
+
+    pinMode(_csPin, OUTPUT);
+    digitalWrite(_csPin, HIGH); // ensure chip deselected early
+    _csOut = portOutputRegister(digitalPinToPort(_csPin));
+    _csMask = digitalPinToBitMask(_csPin);
+
+    // MSPIM init sequence from the datasheet: UBRRn must be 0 when the transmitter is enabled
+    uint32_t ubrr = _spiClock ? F_CPU / (2 * _spiClock) : 0;
+    ubrr = ubrr ? ubrr - 1 : 0; // fSCK = F_CPU / (2 * (UBRRn + 1))
+    if (ubrr > 4095)
+        ubrr = 4095;
+
+    *_ubrr = 0;
+    *_xckDdr |= _xckMask;
+    *_ucsrc = _BV(MSPI_UMSEL1) | _BV(MSPI_UMSEL0);
+    *_ucsrb = _BV(MSPI_TXEN);
+    *_ubrr = ubrr;
+    delay(50); // small stabilization delay
+
+    for (uint8_t i = 0; i < _devsNum; ++i)
+    {
+        setShutdown(i, false);             // Wake up
+        setScanLimit(i, maxColumns() - 1); // Display all 8 digits
+        _spiTransfer(i, OP_DECODEMODE, 0); // No decode
+        testMode(i, false);                // Ensure test mode is OFF
+        clear(i);                          // Clear display
+        setBrightness(i, 8);               // Medium brightness
+    }
+}
+
+void SBK_MAX72xxUsart::setShutdown(uint8_t devIdx, bool status)
+{
+    _spiTransfer(devIdx, OP_SHUTDOWN, status ? 0 : 1);
+}
+
+void SBK_MAX72xxUsart::setScanLimit(uint8_t devIdx, uint8_t limit)
+{
+    _spiTransfer(devIdx, OP_SCANLIMIT, limit & 0x07);
+}
+
+void SBK_MAX72xxUsart::setDecodeMode(uint8_t devIdx, uint8_t mask)
+{
+    _spiTransfer(devIdx, OP_DECODEMODE, mask);
+}
+
+void SBK_MAX72xxUsart::setBrightness(uint8_t devIdx, uint8_t brightness)
+{
+    // constrain the brightness to a 4-bit number (0–15)
+    _spiTransfer(devIdx, OP_INTENSITY, brightness & 0x0F);
+}
+
+void SBK_MAX72xxUsart::setBrightness(const uint8_t *levels)
+{
+    if (!levels)
+        return;
+
+    // One frame: every device latches its own intensity at once
+    _spiTransferAll(OP_INTENSITY, levels, 0x0F);
+}
+
+void SBK_MAX72xxUsart::clear(uint8_t devIdx)
+{
+    if (devIdx >= _devsNum)
+        return;
+
+    _update[devIdx] = true; // Mark this device for update
+
+    for (uint8_t colIdx = 0; colIdx < maxColumns(); colIdx++)
+    {
+        _buffer[_colIndex(devIdx, colIdx)] = 0x00;
+        _spiTransfer(devIdx, OP_DIGIT0 + colIdx, 0x00);
+    }
+}
+
+void SBK_MAX72xxUsart::clear()
+{
+    // Zero the whole chain with 8 chain-packed frames instead of 8 frames per device
+    memset(_buffer, 0, _devsNum * _defaultColBufferSize);
+    for (uint8_t d = 0; d < _devsNum; d++)
+        _update[d] = true;
+
+    show();
+}
+
+void SBK_MAX72xxUsart::setLed(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx, bool state)
+{
+    if (devIdx >= _devsNum || rowIdx >= maxRows(devIdx) || colIdx >= maxColumns())
+        return;
+
+    uint8_t &val = _buffer[_colIndex(devIdx, colIdx)];
+    uint8_t prior = val;
+
+    if (state)
+        val |= _bitMaskRow(devIdx, rowIdx);
+    else
+        val &= ~_bitMaskRow(devIdx, rowIdx);
+
+    if (val != prior)
+        _update[devIdx] = true;
+}
+
+bool SBK_MAX72xxUsart::getLed(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx) const
+{
+    if (devIdx >= _devsNum || rowIdx >= maxRows(devIdx) || colIdx >= maxColumns())
+        return false;
+
+    return (_buffer[_colIndex(devIdx, colIdx)] & _bitMaskRow(devIdx, rowIdx)) != 0;
+}
+
+uint8_t SBK_MAX72xxUsart::getCol(uint8_t devIdx, uint8_t colIdx) const
+{
+    if (devIdx >= _devsNum || colIdx >= maxColumns())
+        return 0;
+
+    return _buffer[_colIndex(devIdx, colIdx)];
+}
+
+void SBK_MAX72xxUsart::getFrame(uint8_t devIdx, uint8_t *out, bool rowMajor) const
+{
+    if (devIdx >= _devsNum || !out)
+        return;
+
+    for (uint8_t colIdx = 0; colIdx < maxColumns(); colIdx++)
+        out[colIdx] = _buffer[_colIndex(devIdx, colIdx)];
+
+    if (rowMajor)
+        SBK_MAX72xxTranspose8x8(out, out);
+}
+
+uint16_t SBK_MAX72xxUsart::copyRegion(uint16_t x, uint16_t width, uint8_t *out, bool rowMajor) const
+{
+    const uint16_t colsNum = _devsNum * maxColumns();
+    if (!out || x >= colsNum)
+        return 0;
+
+    if (width > colsNum - x)
+        width = colsNum - x;
+
+    if (!rowMajor)
+    {
+        for (uint16_t i = 0; i < width; i++, x++)
+            out[i] = _buffer[_colIndex(x / maxColumns(), x % maxColumns())];
+        return width;
+    }
+
+    // Row-major: transpose one 8-column block at a time into 8 rows of stride bytes
+    const uint16_t stride = (width + 7) / 8;
+    for (uint16_t block = 0; block < stride; block++)
+    {
+        uint8_t cols[8] = {0};
+        for (uint8_t i = 0; i < 8 && block * 8 + i < width; i++)
+        {
+            uint16_t col = x + block * 8 + i;
+            cols[i] = _buffer[_colIndex(col / maxColumns(), col % maxColumns())];
+        }
+
+        SBK_MAX72xxTranspose8x8(cols, cols);
+        for (uint8_t rowIdx = 0; rowIdx < 8; rowIdx++)
+            out[rowIdx * stride + block] = cols[rowIdx];
+    }
+    return width;
+}
+
+void SBK_MAX72xxUsart::setCol(uint8_t devIdx, uint8_t colIdx, uint8_t value)
+{
+    if (devIdx >= _devsNum || colIdx >= maxColumns())
+        return;
+
+    if (_buffer[_colIndex(devIdx, colIdx)] != value)
+    {
+        _buffer[_colIndex(devIdx, colIdx)] = value;
+        _update[devIdx] = true; // Mark device for update
+    }
+}
+
+void SBK_MAX72xxUsart::setLedFast(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx, bool state)
+{
+    SBK_MAX72XX_ASSERT(devIdx < _devsNum && rowIdx < maxRows(devIdx) && colIdx < maxColumns());
+
+    uint8_t &val = _buffer[_colIndex(devIdx, colIdx)];
+    uint8_t next = state ? (val | SBK_MAX72xxRowMask[rowIdx]) : (val & ~SBK_MAX72xxRowMask[rowIdx]);
+
+    if (next != val)
+    {
+        val = next;
+        _update[devIdx] = true;
+    }
+}
+
+void SBK_MAX72xxUsart::togglePixel(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx)
+{
+    SBK_MAX72XX_ASSERT(devIdx < _devsNum && rowIdx < maxRows(devIdx) && colIdx < maxColumns());
+
+    _buffer[_colIndex(devIdx, colIdx)] ^= SBK_MAX72xxRowMask[rowIdx];
+    _update[devIdx] = true;
+}
+
+void SBK_MAX72xxUsart::writePixelSpan(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx, uint8_t len, bool state)
+{
+    SBK_MAX72XX_ASSERT(devIdx < _devsNum && rowIdx < maxRows(devIdx) && colIdx + len <= maxColumns());
+
+    const uint8_t mask = SBK_MAX72xxRowMask[rowIdx];
+    for (uint8_t end = colIdx + len; colIdx < end; colIdx++)
+    {
+        uint8_t &val = _buffer[_colIndex(devIdx, colIdx)];
+        uint8_t next = state ? (val | mask) : (val & ~mask);
+
+        if (next != val)
+        {
+            val = next;
+            _update[devIdx] = true;
+        }
+    }
+}
+
+void SBK_MAX72xxUsart::toggleLed(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx)
+{
+    if (devIdx >= _devsNum || rowIdx >= maxRows(devIdx) || colIdx >= maxColumns())
+        return;
+
+    _buffer[_colIndex(devIdx, colIdx)] ^= _bitMaskRow(devIdx, rowIdx);
+    _update[devIdx] = true;
+}
+
+void SBK_MAX72xxUsart::invert(uint8_t devIdx)
+{
+    if (devIdx >= _devsNum)
+        return;
+
+    for (uint8_t colIdx = 0; colIdx < maxColumns(); colIdx++)
+    {
+        _buffer[_colIndex(devIdx, colIdx)] ^= 0xFF;
+        _update[devIdx] = true;
+    }
+}
+
+void SBK_MAX72xxUsart::invertAll()
+{
+    SBK_MAX72xxXorPattern(_buffer, _devsNum * _defaultColBufferSize, 0xFF, 0xFF);
+    for (uint8_t devIdx = 0; devIdx < _devsNum; devIdx++)
+        _update[devIdx] = true;
+}
+
+void SBK_MAX72xxUsart::writeMasked(uint8_t devIdx, uint8_t colIdx, uint8_t mask, uint8_t value)
+{
+    if (devIdx >= _devsNum || colIdx >= maxColumns())
+        return;
+
+    uint8_t &val = _buffer[_colIndex(devIdx, colIdx)];
+    uint8_t next = (val & ~mask) | (value & mask);
+
+    if (next != val)
+    {
+        val = next;
+        _update[devIdx] = true;
+    }
+}
+
+void SBK_MAX72xxUsart::show()
+{
+    if (!_anyUpdate())
+        return;
+
+    waitIdle();
+
+    for (uint8_t colIdx = 0; colIdx < maxColumns(); colIdx++)
+    {
+        _writeColToUpdatedDevices(colIdx);
+    }
+
+    for (uint8_t devIdx = 0; devIdx < _devsNum; devIdx++)
+        _update[devIdx] = false;
+}
+
+void SBK_MAX72xxUsart::show(uint8_t devIdx)
+{
+    if (devIdx >= _devsNum || !_update[devIdx])
+        return;
+
+    waitIdle();
+
+    for (uint8_t colIdx = 0; colIdx < maxColumns(); colIdx++)
+    {
+        _writeColToAllDevices(devIdx, colIdx, _buffer[_colIndex(devIdx, colIdx)]);
+    }
+    _update[devIdx] = false;
+}
+
+void SBK_MAX72xxUsart::showAsync()
+{
+    if (!_udr || !_csOut || !_anyUpdate())
+        return;
+
+    waitIdle(); // _txBuffer may still be read by the ISR
+
+    if (!_txBuffer)
+        _txBuffer = new uint8_t[maxColumns() * _frameBytes()];
+
+    // Same chain-wide frames as show(), laid out back to back
+    uint8_t *out = _txBuffer;
+    for (uint8_t colIdx = 0; colIdx < maxColumns(); colIdx++)
+    {
+        if (_capture)
+            _capture->beginFrame();
+
+        for (int8_t i = _devsNum - 1; i >= 0; i--)
+        {
+            *out++ = _update[i] ? OP_DIGIT0 + colIdx : OP_NOOP;
+            *out++ = _update[i] ? _buffer[_colIndex(i, colIdx)] : 0;
+
+            if (_capture)
+            {
+                _capture->push(out[-2]);
+                _capture->push(out[-1]);
+            }
+        }
+
+        if (_capture)
+            _capture->endFrame();
+    }
+
+    for (uint8_t devIdx = 0; devIdx < _devsNum; devIdx++)
+        _update[devIdx] = false;
+
+    _txPos = 0;
+    _txFrameEnd = _frameBytes();
+    _txEnd = maxColumns() * _frameBytes();
+    _busy = true;
+
+    *_csOut &= ~_csMask;
+    *_ucsrb |= _BV(MSPI_UDRIE); // The ISR takes it from here
+}
+
+void SBK_MAX72xxUsart::handleUdre()
+{
+    *_udr = _txBuffer[_txPos++];
+
+    if (_txPos == _txFrameEnd)
+    {
+        // Last byte of the frame is loaded: wait for it to leave the shift register
+        *_ucsra = _BV(MSPI_TXC);
+        *_ucsrb = (*_ucsrb & ~_BV(MSPI_UDRIE)) | _BV(MSPI_TXCIE);
+    }
+}
+
+void SBK_MAX72xxUsart::handleTxc()
+{
+    *_csOut |= _csMask; // Latch the frame
+
+    if (_txPos < _txEnd)
+    {
+        _txFrameEnd += _frameBytes();
+        *_csOut &= ~_csMask;
+        *_ucsrb = (*_ucsrb & ~_BV(MSPI_TXCIE)) | _BV(MSPI_UDRIE);
+    }
+    else
+    {
+        *_ucsrb &= ~_BV(MSPI_TXCIE);
+        _busy = false;
+    }
+}
+
+void SBK_MAX72xxUsart::testMode(uint8_t devIdx, bool enable)
+{
+    if (devIdx >= _devsNum)
+        return;
+
+    // MAX7219 test mode uses register 0x0F
+    // value 1 = test ON (all segments), 0 = test OFF
+    _spiTransfer(devIdx, OP_DISPLAYTEST, enable ? 1 : 0);
+}
+
+void SBK_MAX72xxUsart::_spiTransfer(uint8_t targetDevice, uint8_t opcode, uint8_t data)
+{
+    if (targetDevice >= _devsNum || !_udr || !_csOut)
+        return; // Prevent invalid access
+
+    waitIdle(); // Keep register writes ordered after a pending showAsync()
+
+    _beginFrame();
+
+    for (int8_t i = _devsNum - 1; i >= 0; i--)
+    {
+        uint8_t op = (i == static_cast<int8_t>(targetDevice)) ? opcode : OP_NOOP;
+        uint8_t val = (i == static_cast<int8_t>(targetDevice)) ? data : 0;
+
+        _shiftByte(op);
+        _shiftByte(val);
+    }
+
+    _endFrame();
+}
+
+void SBK_MAX72xxUsart::_spiTransferAll(uint8_t opcode, const uint8_t *data, uint8_t mask)
+{
+    if (!_udr || !_csOut)
+        return; // Prevent invalid access
+
+    waitIdle(); // Keep register writes ordered after a pending showAsync()
+
+    _beginFrame();
+
+    for (int8_t i = _devsNum - 1; i >= 0; i--)
+    {
+        _shiftByte(opcode);
+        _shiftByte(data[i] & mask);
+    }
+
+    _endFrame();
+}
+
+void SBK_MAX72xxUsart::_writeColToAllDevices(uint8_t targetDevice, uint8_t colIdx, uint8_t data)
+{
+    if (targetDevice >= _devsNum || colIdx >= maxColumns() || !_udr || !_csOut)
+        return;
+
+    _beginFrame();
+
+    for (int8_t i = _devsNum - 1; i >= 0; i--)
+    {
+        uint8_t opcode = (i == static_cast<int8_t>(targetDevice)) ? (OP_DIGIT0 + colIdx) : OP_NOOP;
+        uint8_t val = (i == static_cast<int8_t>(targetDevice)) ? data : 0;
+
+        _shiftByte(opcode);
+        _shiftByte(val);
+    }
+
+    _endFrame();
+}
+
+void SBK_MAX72xxUsart::_writeColToUpdatedDevices(uint8_t colIdx)
+{
+    if (colIdx >= maxColumns() || !_udr || !_csOut)
+        return;
+
+    _beginFrame();
+
+    // One frame refreshes this digit on every updated device; unchanged devices get a NOOP
+    for (int8_t i = _devsNum - 1; i >= 0; i--)
+    {
+        if (_update[i])
+        {
+            _shiftByte(OP_DIGIT0 + colIdx);
+            _shiftByte(_buffer[_colIndex(i, colIdx)]);
+        }
+        else
+        {
+            _shiftByte(OP_NOOP);
+            _shiftByte(0);
+        }
+    }
+
+    _endFrame();
+}
+
+bool SBK_MAX72xxUsart::_anyUpdate() const
+{
+    for (uint8_t devIdx = 0; devIdx < _devsNum; devIdx++)
+    {
+        if (_update[devIdx])
+            return true;
+    }
+    return false;
+}
+
+inline void SBK_MAX72xxUsart::_beginFrame()
+{
+    *_csOut &= ~_csMask;
+    if (_capture)
+        _capture->beginFrame();
+}
+
+inline void SBK_MAX72xxUsart::_shiftByte(uint8_t data)
+{
+    // Double-buffered: the next byte is queued while the previous one is still shifting out
+    while (!(*_ucsra & _BV(MSPI_UDRE)))
+    {
+    }
+    *_udr = data;
+    *_ucsra = _BV(MSPI_TXC); // Clear TXC so it only flags the end of this byte
+    if (_capture)
+        _capture->push(data);
+}
+
+inline void SBK_MAX72xxUsart::_endFrame()
+{
+    while (!(*_ucsra & _BV(MSPI_TXC)))
+    {
+    }
+    *_csOut |= _csMask;
+    if (_capture)
+        _capture->endFrame();
+}
+
+inline uint8_t SBK_MAX72xxUsart::_bitMaskRow(uint8_t devIdx, uint8_t rowIdx) const
+{
+    (void)devIdx;
+    return SBK_MAX72xxRowMask[rowIdx]; // Same as 1 << (maxRows() - 1 - rowIdx), without the shift loop on AVR
+}
+
+inline uint8_t SBK_MAX72xxUsart::_colIndex(uint8_t devIdx, uint8_t colIdx) const
+{
+    return devIdx * _defaultColBufferSize + colIdx;
+}
+
+#endif // __AVR__
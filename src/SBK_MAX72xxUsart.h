@@ -0,0 +1,465 @@
+/**
+ * @file SBK_MAX72xxUsart.h
+ * @brief AVR USART-in-Master-SPI-mode driver for controlling multiple MAX7219/MAX7221 LED matrix chips.
+ *
+ * Part of the SBK_MAX72xx Arduino Library.
+ * ATmega parts have a single SPI peripheral; their USARTs can also run as SPI masters (MSPIM),
+ * clocked up to fosc/2 with a double-buffered transmit register. This driver uses one of them
+ * so a second chain runs at hardware speed instead of falling back to shiftOut().
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ *
+ * @version 2.0.4
+ *
+ * @license MIT
+ *
+ * @copyright
+ * Copyright (c) 2025 Samuel Barabé
+ *
+ * Repository: https://github.com/sbarabe/SBK_MAX72xx
+ */
+
+#pragma once
+
+#define SBK_MAX72xx_IS_DEFINED
+
+#if !defined(__AVR__)
+#error "SBK_MAX72xxUsart requires an AVR target. Use SBK_MAX72xxHard or SBK_MAX72xxSoft instead."
+#endif
+
+#include <Arduino.h>
+#include "SBK_MAX72xxCapture.h"
+#include "SBK_MAX72xxFast.h"
+
+/**
+ * @brief Define the USART interrupt vectors that feed SBK_MAX72xxUsart::showAsync().
+ *
+ * Place once at file scope in the sketch, after the driver instance:
+ * @code
+ * SBK_MAX72xxUsart chain2(7, 4, 0);
+ * SBK_MAX72XX_USART_ISR(USART, chain2)   // ATmega328P: USART_UDRE_vect / USART_TX_vect
+ * // SBK_MAX72XX_USART_ISR(USART1, chain2) // ATmega2560: USART1_UDRE_vect / USART1_TX_vect
+ * @endcode
+ *
+ * @note These vectors are the ones HardwareSerial uses for the same USART, so the matching
+ *       SerialN object can't be used in the same sketch.
+ */
+#define SBK_MAX72XX_USART_ISR(vectPrefix, driver)        \
+    ISR(vectPrefix##_UDRE_vect) { (driver).handleUdre(); } \
+    ISR(vectPrefix##_TX_vect) { (driver).handleTxc(); }
+
+/**
+ * @class SBK_MAX72xxUsart
+ * @brief Controls multiple MAX7219/MAX7221 LED drivers via an AVR USART in Master SPI mode.
+ *
+ * Wiring: TXDn -> DIN, XCKn -> CLK, any digital pin -> CS. The receiver is left disabled,
+ * so RXDn stays free. show() polls the transmit buffer; showAsync() lets the USART
+ * interrupts push the whole refresh in the background (see SBK_MAX72XX_USART_ISR).
+ */
+class SBK_MAX72xxUsart
+{
+public:
+    /**
+     * @brief Construct a new USART MSPI SBK_MAX72xxUsart driver instance.
+     *
+     * @param csPin        Chip Select (CS) pin.
+     * @param devsNum      Number of daisy-chained MAX72xx devices. Default is 1.
+     * @param usartNum     USART peripheral number (0 on ATmega328P, 0–3 on ATmega2560,
+     *                     1 on ATmega32U4). Default is 0.
+     *
+     * Initializes internal display buffer for each device in the chain.
+     * Each device reserves 8 bytes — one for each digit line (DIG0–DIG7), representing columns (cathode outputs).
+     * @note Each byte in the buffer holds segment (SEG0–SEG7) values for one column.
+     * @note On ATmega328P, USART0 shares pins 0/1 with Serial: TXD0 = D1, XCK0 = D4.
+     * @note Supported MCUs: ATmega48/88/168/328(P/PB), ATmega644P/1284P, ATmega1280/2560
+     *       and ATmega32U4. On others, or for a USART the MCU doesn't have, begin() does nothing.
+     */
+    SBK_MAX72xxUsart(uint8_t csPin, uint8_t devsNum = 1, uint8_t usartNum = 0);
+
+    /**
+     * @brief Set SPI clock speed. Call before begin().
+     * @param frequency Frequency in Hz, at most F_CPU / 2 (e.g., 8000000 on a 16 MHz board).
+     */
+    void setSPIClock(uint32_t frequency);
+
+    /**
+     * @brief Wait for a pending showAsync(), then disable the USART.
+     */
+    void end();
+
+    ~SBK_MAX72xxUsart(); // Destructor
+
+    /**
+     * @brief Returns the number of addressable row lines (anode outputs = SEGx).
+     *
+     * @param devIdx Index of the target device (0-based in daisy chain).
+     *               This parameter is ignored for MAX7219/7221 chips,
+     *               but included for API compatibility with SBK_BarDrive.
+     *
+     * For MAX7219/7221 drivers, this value is always 8, since each column (DIGx)
+     * can display up to 8 vertical segments connected to SEG0–SEG7 (anode lines).
+     *
+     * @return Number of row lines (SEGx/anodes), always 8 for MAX72xx devices.
+     */
+    uint8_t maxRows(uint8_t devIdx = 0) const
+    {
+        (void)devIdx;
+        return _defaultRowBufferSize;
+    }
+
+    /**
+     * @brief Returns the number of addressable columns (cathode outputs = DIGx).
+     *
+     * This is a fixed value of 8 for MAX7219/7221, since each digit line (DIG0–DIG7) selects one column (cathode).
+     * Each DIGx line maps to one 8-bit buffer entry representing the vertical SEGx lines.
+     *
+     * @return Number of columns (DIGx = cathode outputs), always 8.
+     */
+    uint8_t maxColumns() const { return _defaultColBufferSize; }
+
+    /**
+     * @brief Returns the total number of addressable LED segments for this device.
+     *
+     * @param devIdx Index of the target device (0-based in daisy chain).
+     *               This parameter is ignored for MAX7219/7221 chips,
+     *               but is included for API compatibility with SBK_BarDrive.
+     *
+     * This value is computed as:
+     * `maxRows(devIdx) × maxColumns()`
+     * For MAX7219/7221, this is always 8 × 8 = 64 segments per device.
+     *
+     * @return Total number of addressable LED segments (pixels) for this device.
+     */
+    uint8_t maxSegments(uint8_t devIdx = 0) const { return maxRows(devIdx) * maxColumns(); }
+
+    /**
+     * @brief Switch the USART to Master SPI mode and initialize all MAX72xx chips.
+     */
+    void begin();
+
+    /**
+     * @brief Enable or disable shutdown mode on a specific device.
+     *
+     * @param devIdx Index of the target device.
+     * @param status false = shutdown, true = normal operation
+     */
+    void setShutdown(uint8_t devIdx, bool status);
+
+    /**
+     * @brief Set the scan limit (number of active digits) for a specific device.
+     *
+     * @param devIdx Target device index.
+     * @param limit  Value from 0 to 7.
+     */
+    void setScanLimit(uint8_t devIdx, uint8_t limit);
+
+    /**
+     * @brief Set the BCD Code-B decode mode of a specific device.
+     *
+     * @param devIdx Target device index.
+     * @param mask   One bit per digit (bit n = DIGn): 1 = Code-B, 0 = no decode (default).
+     *
+     * Digits in Code-B mode show the low nibble of their buffer byte as 0–9, '-', 'E',
+     * 'H', 'L', 'P' or blank, and bit 7 as the decimal point.
+     */
+    void setDecodeMode(uint8_t devIdx, uint8_t mask);
+
+    /**
+     * @brief Set display brightness for a specific device.
+     *
+     * @param devIdx Target device index.
+     * @param brightness Value from 0 (min) to 15 (max).
+     */
+    void setBrightness(uint8_t devIdx, uint8_t brightness);
+
+    /**
+     * @brief Set the brightness of every device with a single chain frame.
+     *
+     * @param levels One value per device, 0 (min) to 15 (max), device 0 first.
+     */
+    void setBrightness(const uint8_t *levels);
+
+    /**
+     * @brief Return the number of actives driver devices.
+     *
+     * @return number of actives driver devices.
+     */
+    uint8_t devsNum() const { return _devsNum; }
+
+    /**
+     * @brief Clear display buffer and hardware for one device.
+     *
+     * @param devIdx Target device index.
+     */
+    void clear(uint8_t devIdx);
+
+    /**
+     * @brief Clear display buffers and hardware for all devices.
+     *
+     * The whole chain is cleared with 8 chain-wide frames (see show()).
+     */
+    void clear();
+
+    /**
+     * @brief Set the state of a specific LED in the device’s internal matrix buffer.
+     *
+     * @param devIdx    Index of the target device (0-based in daisy chain).
+     * @param rowIdx    Logical rowIdx index (0 to maxRows(_devIdx) - 1) — vertical position (anode).
+     * @param colIdx    Logical column index (0 to maxColumns() - 1) — horizontal position (cathode).
+     * @param state     true = LED ON, false = LED OFF.
+     *
+     * @note The coordinate system follows a standard [row, col] layout.
+     *       For MAX72xx drivers:
+     *         - row corresponds to SEGx (segment outputs, V+ source = anode)
+     *         - col corresponds to DIGx (digit selectors, GND sink = cathode)
+     *
+     * This function updates the internal buffer; call show() to apply changes to hardware.
+     */
+    void setLed(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx, bool state);
+
+    /**
+     * @brief Get the state of a specific LED in the device’s internal matrix buffer.
+     *
+     * This function reads the last known state of a given LED at the specified row and column
+     * on a target device. It does not access the physical display hardware, but instead reads from
+     * the internal RAM buffer used for batching updates.
+     *
+     * @note This function may not reflect real-time display contents unless `show()` has been called
+     * after `setLed()`. For animations or state-dependent logic, ensure consistency by calling `show()` regularly.
+     *
+     * @param devIdx Index of the target device (0-based).
+     * @param rowIdx Row index (0–7).
+     * @param colIdx Column index (0–7).
+     * @return true if the LED is currently set ON in the buffer, false if OFF or invalid.
+     *
+     * @note The coordinate system follows a standard [row, col] layout.
+     *       For MAX72xx drivers:
+     *         - row corresponds to SEGx (segment outputs, V+ source = anode)
+     *         - col corresponds to DIGx (digit selectors, GND sink = cathode)
+     */
+    bool getLed(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx) const;
+
+    /**
+     * @brief Read one column byte from the buffer.
+     *
+     * @param devIdx Index of the target device.
+     * @param colIdx Column number (0 to 7).
+     * @return Column byte (row 0 = MSB), 0 if out of range.
+     */
+    uint8_t getCol(uint8_t devIdx, uint8_t colIdx) const;
+
+    /**
+     * @brief Copy the 8 column bytes of one device from the buffer.
+     *
+     * @param devIdx   Index of the target device.
+     * @param out      Destination, 8 bytes.
+     * @param rowMajor false = column bytes as setCol() takes them; true = 8 row bytes
+     *                 (row 0 first, column 0 = MSB), via an 8x8 bit transpose.
+     */
+    void getFrame(uint8_t devIdx, uint8_t *out, bool rowMajor = false) const;
+
+    /**
+     * @brief Snapshot a run of columns across the chain.
+     *
+     * Columns are numbered chain-wide: x = devIdx × 8 + colIdx.
+     *
+     * @param x        First column.
+     * @param width    Number of columns, clipped to the end of the chain.
+     * @param out      Destination: @p width column bytes, or with @p rowMajor 8 rows of
+     *                 (width + 7) / 8 bytes each (leftmost column = MSB of the first byte).
+     * @param rowMajor Transpose to row-major as in getFrame().
+     * @return Number of columns copied.
+     */
+    uint16_t copyRegion(uint16_t x, uint16_t width, uint8_t *out, bool rowMajor = false) const;
+
+    /**
+     * @brief Set the entire col value for a specific device (buffer only).
+     *
+     * @param devIdx    Index of the target device.
+     * @param colIdx    Column number (0 to 7).
+     * @param value     8-bit value for the row.
+     */
+    void setCol(uint8_t devIdx, uint8_t colIdx, uint8_t value);
+
+    /**
+     * @brief Unchecked setLed() for inner drawing loops that already clip their coordinates.
+     *
+     * Same effect as setLed() without the three bounds checks. Out-of-range arguments are
+     * undefined behavior; build with `SBK_MAX72XX_DEBUG` to turn them into assertions.
+     */
+    void setLedFast(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx, bool state);
+
+    /**
+     * @brief Unchecked pixel toggle (see setLedFast()).
+     */
+    void togglePixel(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx);
+
+    /**
+     * @brief Unchecked horizontal run: set @p len pixels of row @p rowIdx from column @p colIdx.
+     *
+     * The span must stay on one device (colIdx + len <= maxColumns()). See setLedFast().
+     */
+    void writePixelSpan(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx, uint8_t len, bool state);
+
+    /**
+     * @brief Toggle one LED in the buffer.
+     *
+     * @param devIdx Index of the target device.
+     * @param rowIdx Row index (0–7).
+     * @param colIdx Column index (0–7).
+     */
+    void toggleLed(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx);
+
+    /**
+     * @brief Invert every LED of one device (buffer only).
+     *
+     * @param devIdx Index of the target device.
+     */
+    void invert(uint8_t devIdx);
+
+    /**
+     * @brief Invert every LED of the chain (buffer only), a 32-bit word at a time.
+     */
+    void invertAll();
+
+    /**
+     * @brief Write only the masked bits of a column (buffer only).
+     *
+     * @param devIdx Index of the target device.
+     * @param colIdx Column number (0 to 7).
+     * @param mask   Bits to change (row 0 = MSB).
+     * @param value  New values for the bits set in @p mask; other bits are ignored.
+     */
+    void writeMasked(uint8_t devIdx, uint8_t colIdx, uint8_t mask, uint8_t value);
+
+    /**
+     * @brief Push the internal display buffer to all connected devices.
+     *
+     * This flushes all buffered LED states to the physical hardware for every device
+     * managed by this driver instance. Use this after making multiple `setLed()` calls
+     * to apply the changes to the display.
+     *
+     * Typically used in split-device or multi-bar meter setups.
+     *
+     * All updated devices are refreshed together: each of the 8 digit registers is sent
+     * in a single chain-wide frame, with NOOPs for devices that did not change.
+     * Bytes are loaded into the double-buffered transmit register as soon as it frees up,
+     * so the clock runs back-to-back within a frame.
+     */
+    void show();
+
+    /**
+     * @brief Push the internal display buffer to all devices in the background.
+     *
+     * Same frames as show(), but sent from the USART Data Register Empty and Transmit
+     * Complete interrupts: this call returns immediately. Any register write or show()
+     * issued before completion waits for it.
+     *
+     * @warning The sketch must install the interrupt vectors with SBK_MAX72XX_USART_ISR(),
+     *          otherwise the first interrupt resets the MCU.
+     */
+    void showAsync();
+
+    /**
+     * @brief Check whether a showAsync() refresh is still being sent.
+     */
+    bool busy() const { return _busy; }
+
+    /**
+     * @brief Block until a pending showAsync() refresh has been sent.
+     */
+    void waitIdle() const
+    {
+        while (_busy)
+        {
+        }
+    }
+
+    /**
+     * @brief Push the internal display buffer to a specific device.
+     *
+     * @param devIdx Index of the target device (0-based in the daisy chain).
+     *
+     * Only the specified device's display will be updated. Useful for optimized
+     * partial updates when only one device has changed.
+     *
+     * @note The driver must track changes correctly for this to be meaningful.
+     */
+    void show(uint8_t devIdx);
+
+     /**
+     * @brief Enable/disable display-test mode on all devices.
+     */
+    void testMode(bool enable)
+    {
+        for (uint8_t i = 0; i < _devsNum; i++)
+            testMode(i, enable);
+    }
+
+    /**
+     * @brief Enable or disable the MAX72xx display test mode.
+     *
+     * @param devIdx Target device index (0-based)
+     * @param enable true = enable test mode (all LEDs ON), false = disable
+     */
+    void testMode(uint8_t devIdx, bool enable);
+
+    /**
+     * @brief Record every SPI frame sent by this driver.
+     *
+     * @param capture Capture to feed (see SBK_MAX72xxCapture), or nullptr to stop recording.
+     *
+     * The capture must outlive the driver or be detached before it is destroyed.
+     */
+    void setCapture(SBK_MAX72xxCapture *capture) { _capture = capture; }
+
+    /**
+     * @brief Interrupt handlers for showAsync(); called by SBK_MAX72XX_USART_ISR().
+     */
+    void handleUdre();
+    void handleTxc();
+
+private:
+    void _spiTransfer(uint8_t targetDevice, uint8_t opcode, uint8_t data);
+    void _spiTransferAll(uint8_t opcode, const uint8_t *data, uint8_t mask = 0xFF);
+    void _writeColToAllDevices(uint8_t targetDevice, uint8_t colIdx, uint8_t data);
+    void _writeColToUpdatedDevices(uint8_t colIdx);
+    bool _anyUpdate() const;
+    inline void _beginFrame();
+    inline void _shiftByte(uint8_t data);
+    inline void _endFrame();
+    inline uint8_t _bitMaskRow(uint8_t devIdx, uint8_t rowIdx) const;
+    inline uint8_t _colIndex(uint8_t devIdx, uint8_t colIdx) const;
+    inline uint8_t _frameBytes() const { return _devsNum * 2; }
+
+    const uint8_t _csPin;
+    const uint8_t _devsNum = 1;
+
+    static constexpr uint8_t _defaultRowBufferSize = 8;
+    static constexpr uint8_t _defaultColBufferSize = 8;
+    uint8_t *_buffer; // Internal display buffer
+    bool *_update;    // Array to track if data has changed per device
+
+    SBK_MAX72xxCapture *_capture = nullptr; // Optional SPI frame recorder
+
+    // USARTn registers (nullptr if the requested USART doesn't exist on this MCU)
+    volatile uint8_t *_ucsra = nullptr;
+    volatile uint8_t *_ucsrb = nullptr;
+    volatile uint8_t *_ucsrc = nullptr;
+    volatile uint16_t *_ubrr = nullptr;
+    volatile uint8_t *_udr = nullptr;
+    volatile uint8_t *_xckDdr = nullptr;
+    uint8_t _xckMask = 0;
+
+    volatile uint8_t *_csOut = nullptr; // CS toggled directly, also from the ISR
+    uint8_t _csMask = 0;
+
+    uint8_t *_txBuffer = nullptr; // showAsync() frames, one per digit register
+    volatile uint8_t _txPos = 0;
+    volatile uint8_t _txFrameEnd = 0;
+    uint8_t _txEnd = 0;
+    volatile bool _busy = false;
+
+    uint32_t _spiClock = 1000000; // Default 1 MHz
+};
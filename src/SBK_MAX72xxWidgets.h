@@ -0,0 +1,483 @@
+/**
+ * @file SBK_MAX72xxWidgets.h
+ * @brief Retained-mode widgets (label, counter, bar, icon, clock) drawn on a SBK_MAX72xxCanvas.
+ *
+ * Part of the SBK_MAX72xx Arduino Library.
+ * Each widget owns a region of the canvas and keeps its own state. Setters only mark the
+ * widget invalid when the value really changes; SBK_MAX72xxScreen::update() re-rasterizes
+ * invalid widgets only, the canvas flags only the columns whose bytes changed, and the
+ * driver only sends those digit registers. Work follows what changed, not screen size.
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ *
+ * @version 2.0.4
+ *
+ * @license MIT
+ *
+ * @copyright
+ * Copyright (c) 2025 Samuel Barabé
+ *
+ * Repository: https://github.com/sbarabe/SBK_MAX72xx
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+#include "SBK_MAX72xxCanvas.h"
+#include "SBK_MAX72xxFont.h"
+
+/**
+ * @class SBK_MAX72xxWidget
+ * @brief Base class: a canvas region (8 rows tall) that redraws itself only when invalid.
+ *
+ * @tparam Driver Driver type of the canvas.
+ */
+template <typename Driver>
+class SBK_MAX72xxWidget
+{
+public:
+    /**
+     * @param x     First canvas column of the widget.
+     * @param y     Canvas row of the widget's top row.
+     * @param width Widget width in columns.
+     */
+    SBK_MAX72xxWidget(int16_t x, int16_t y, uint16_t width)
+        : _x(x), _y(y), _width(width)
+    {
+    }
+
+    virtual ~SBK_MAX72xxWidget() {}
+
+    /**
+     * @brief Force a redraw on the next render().
+     */
+    void invalidate() { _invalid = true; }
+
+    /**
+     * @brief true when the widget must be redrawn.
+     */
+    bool invalid() const { return _invalid; }
+
+    /**
+     * @brief Redraw into @p canvas if invalid.
+     *
+     * @return true if the widget was redrawn.
+     */
+    bool render(SBK_MAX72xxCanvas<Driver> &canvas)
+    {
+        if (!_invalid)
+            return false;
+
+        draw(canvas);
+        _invalid = false;
+        return true;
+    }
+
+    /**
+     * @brief Share a glyph cache (may be used by several widgets), or nullptr for none.
+     */
+    void setGlyphCache(SBK_MAX72xxGlyphCache *cache) { _cache = cache; }
+
+    int16_t x() const { return _x; }
+    int16_t y() const { return _y; }
+    uint16_t width() const { return _width; }
+
+protected:
+    /**
+     * @brief Rasterize the widget. Called by render() only when invalid.
+     */
+    virtual void draw(SBK_MAX72xxCanvas<Driver> &canvas) = 0;
+
+    /**
+     * @brief Fill the whole region with UTF-8 @p text; columns past the text are cleared.
+     */
+    void drawText(SBK_MAX72xxCanvas<Driver> &canvas, const char *text, SBK_MAX72xxAlign align,
+                  const SBK_MAX72xxFont &font)
+    {
+        const uint8_t advance = font.advance();
+        const uint16_t len = SBK_MAX72xxUtf8Length(text);
+        const int32_t textWidth = len ? static_cast<int32_t>(len) * advance - font.spacing : 0;
+
+        int32_t start = 0;
+        if (align == SBK_MAX72xxAlign::Right)
+            start = static_cast<int32_t>(_width) - textWidth;
+        else if (align == SBK_MAX72xxAlign::Center)
+            start = (static_cast<int32_t>(_width) - textWidth) / 2;
+
+        const uint8_t *glyph = nullptr;
+        int32_t glyphIdx = -1;
+        for (uint16_t i = 0; i < _width; i++)
+        {
+            uint8_t value = 0;
+            int32_t t = static_cast<int32_t>(i) - start;
+            if (t >= 0 && t < textWidth)
+            {
+                // Characters are decoded in order as the columns advance
+                while (glyphIdx < t / advance)
+                {
+                    uint16_t c = SBK_MAX72xxUtf8Next(text);
+                    glyph = _cache ? _cache->glyph(font, c) : font.glyph(c);
+                    glyphIdx++;
+                }
+
+                uint8_t col = t % advance;
+                if (glyph && col < font.width)
+                    value = SBK_MAX72xxReadFlash(glyph + col);
+            }
+            canvas.writeCol(_x + i, _y, value);
+        }
+    }
+
+    const int16_t _x;
+    const int16_t _y;
+    const uint16_t _width;
+    bool _invalid = true; // Draw once after creation
+
+    const SBK_MAX72xxFont *_font = &SBK_MAX72xxFont5x7;
+    SBK_MAX72xxGlyphCache *_cache = nullptr;
+};
+
+/**
+ * @class SBK_MAX72xxLabel
+ * @brief Static or occasionally changing text.
+ *
+ * @tparam MaxChars Longest text kept, in bytes of UTF-8 (longer text is truncated).
+ */
+template <typename Driver, uint8_t MaxChars = 16>
+class SBK_MAX72xxLabel : public SBK_MAX72xxWidget<Driver>
+{
+public:
+    SBK_MAX72xxLabel(int16_t x, int16_t y, uint16_t width, const char *text = "",
+                     SBK_MAX72xxAlign align = SBK_MAX72xxAlign::Left)
+        : SBK_MAX72xxWidget<Driver>(x, y, width), _align(align)
+    {
+        setText(text);
+    }
+
+    /**
+     * @brief Change the text. Invalidates only if it differs from the current one.
+     *
+     * Text longer than MaxChars bytes is cut after its last complete UTF-8 character.
+     */
+    void setText(const char *text)
+    {
+        if (!text)
+            return;
+
+        uint16_t len = 0;
+        while (len < MaxChars && text[len])
+            len++;
+        // Never keep a lead byte without its continuation bytes
+        while (len > 0 && (static_cast<uint8_t>(text[len]) & 0xC0) == 0x80)
+            len--;
+
+        if (strncmp(_text, text, len) == 0 && _text[len] == '\0')
+            return;
+
+        memcpy(_text, text, len);
+        _text[len] = '\0';
+        this->invalidate();
+    }
+
+    const char *text() const { return _text; }
+
+    void setFont(const SBK_MAX72xxFont &font)
+    {
+        this->_font = &font;
+        this->invalidate();
+    }
+
+protected:
+    void draw(SBK_MAX72xxCanvas<Driver> &canvas) override
+    {
+        this->drawText(canvas, _text, _align, *this->_font);
+    }
+
+private:
+    char _text[MaxChars + 1] = {0};
+    const SBK_MAX72xxAlign _align;
+};
+
+/**
+ * @class SBK_MAX72xxCounter
+ * @brief Right-aligned decimal number.
+ */
+template <typename Driver>
+class SBK_MAX72xxCounter : public SBK_MAX72xxWidget<Driver>
+{
+public:
+    /**
+     * @param minDigits Pad with leading zeros up to this many digits (0 = no padding).
+     */
+    SBK_MAX72xxCounter(int16_t x, int16_t y, uint16_t width, uint8_t minDigits = 0)
+        : SBK_MAX72xxWidget<Driver>(x, y, width), _minDigits(minDigits)
+    {
+    }
+
+    /**
+     * @brief Change the value. Invalidates only if it differs from the current one.
+     */
+    void setValue(int32_t value)
+    {
+        if (value != _value)
+        {
+            _value = value;
+            this->invalidate();
+        }
+    }
+
+    int32_t value() const { return _value; }
+
+protected:
+    void draw(SBK_MAX72xxCanvas<Driver> &canvas) override
+    {
+        char text[13]; // Sign + 10 digits + NUL, with room for padding
+        char *p = text + sizeof(text) - 1;
+        *p = '\0';
+
+        uint32_t v = (_value < 0) ? 0u - static_cast<uint32_t>(_value) : static_cast<uint32_t>(_value);
+        uint8_t digits = 0;
+        do
+        {
+            *--p = '0' + v % 10;
+            v /= 10;
+            digits++;
+        } while ((v || digits < _minDigits) && p > text + 1);
+
+        if (_value < 0)
+            *--p = '-';
+
+        this->drawText(canvas, p, SBK_MAX72xxAlign::Right, *this->_font);
+    }
+
+private:
+    int32_t _value = 0;
+    const uint8_t _minDigits;
+};
+
+/**
+ * @class SBK_MAX72xxBar
+ * @brief Horizontal bar graph. A value change redraws only the columns between the old and new ends.
+ */
+template <typename Driver>
+class SBK_MAX72xxBar : public SBK_MAX72xxWidget<Driver>
+{
+public:
+    /**
+     * @param maxValue Value drawn as a full bar.
+     * @param pattern  Column byte of a lit bar column (row 0 = MSB). Default is rows 1–6.
+     */
+    SBK_MAX72xxBar(int16_t x, int16_t y, uint16_t width, uint16_t maxValue = 100, uint8_t pattern = 0x7E)
+        : SBK_MAX72xxWidget<Driver>(x, y, width), _maxValue(maxValue ? maxValue : 1), _pattern(pattern)
+    {
+    }
+
+    /**
+     * @brief Change the value (clipped to maxValue). Invalidates only if the drawn length changes.
+     */
+    void setValue(uint16_t value)
+    {
+        if (value > _maxValue)
+            value = _maxValue;
+
+        uint16_t fill = static_cast<uint32_t>(value) * this->_width / _maxValue;
+        if (fill != _fill)
+        {
+            _fill = fill;
+            this->invalidate();
+        }
+    }
+
+protected:
+    void draw(SBK_MAX72xxCanvas<Driver> &canvas) override
+    {
+        // First draw covers the whole region, later ones only the span that moved
+        uint16_t from = _drawn ? (_fill < _drawnFill ? _fill : _drawnFill) : 0;
+        uint16_t to = _drawn ? (_fill < _drawnFill ? _drawnFill : _fill) : this->_width;
+
+        for (uint16_t i = from; i < to; i++)
+            canvas.writeCol(this->_x + i, this->_y, i < _fill ? _pattern : 0x00);
+
+        _drawnFill = _fill;
+        _drawn = true;
+    }
+
+private:
+    const uint16_t _maxValue;
+    const uint8_t _pattern;
+    uint16_t _fill = 0;
+    uint16_t _drawnFill = 0;
+    bool _drawn = false;
+};
+
+/**
+ * @class SBK_MAX72xxIcon
+ * @brief Bitmap of width() column bytes, optionally animated over several frames.
+ */
+template <typename Driver>
+class SBK_MAX72xxIcon : public SBK_MAX72xxWidget<Driver>
+{
+public:
+    /**
+     * @param columns  Column bytes, frames back to back (width() bytes each).
+     * @param framesNum Number of frames in @p columns.
+     * @param inFlash  true if @p columns is declared PROGMEM (default).
+     */
+    SBK_MAX72xxIcon(int16_t x, int16_t y, uint16_t width, const uint8_t *columns, uint8_t framesNum = 1,
+                    bool inFlash = true)
+        : SBK_MAX72xxWidget<Driver>(x, y, width), _columns(columns), _framesNum(framesNum ? framesNum : 1),
+          _inFlash(inFlash)
+    {
+    }
+
+    /**
+     * @brief Show another frame. Invalidates only if it differs from the current one.
+     */
+    void setFrame(uint8_t frame)
+    {
+        frame %= _framesNum;
+        if (frame != _frame)
+        {
+            _frame = frame;
+            this->invalidate();
+        }
+    }
+
+    /**
+     * @brief Advance to the next frame, wrapping around.
+     */
+    void nextFrame() { setFrame(_frame + 1); }
+
+    uint8_t frame() const { return _frame; }
+
+protected:
+    void draw(SBK_MAX72xxCanvas<Driver> &canvas) override
+    {
+        const uint8_t *p = _columns + _frame * this->_width;
+        for (uint16_t i = 0; i < this->_width; i++, p++)
+            canvas.writeCol(this->_x + i, this->_y, _inFlash ? SBK_MAX72xxReadFlash(p) : *p);
+    }
+
+private:
+    const uint8_t *_columns;
+    const uint8_t _framesNum;
+    const bool _inFlash;
+    uint8_t _frame = 0;
+};
+
+/**
+ * @class SBK_MAX72xxClock
+ * @brief 24-hour "HH:MM" or "HH:MM:SS" clock with an optional blinking colon.
+ */
+template <typename Driver>
+class SBK_MAX72xxClock : public SBK_MAX72xxWidget<Driver>
+{
+public:
+    SBK_MAX72xxClock(int16_t x, int16_t y, uint16_t width, bool showSeconds = false)
+        : SBK_MAX72xxWidget<Driver>(x, y, width), _showSeconds(showSeconds)
+    {
+    }
+
+    /**
+     * @brief Change the time. Invalidates only if a displayed field changes.
+     */
+    void setTime(uint8_t hours, uint8_t minutes, uint8_t seconds = 0)
+    {
+        if (!_showSeconds)
+            seconds = 0; // Not displayed, so not a reason to redraw
+
+        if (hours != _hours || minutes != _minutes || seconds != _seconds)
+        {
+            _hours = hours;
+            _minutes = minutes;
+            _seconds = seconds;
+            this->invalidate();
+        }
+    }
+
+    /**
+     * @brief Show or hide the colons (call every half second to blink them).
+     */
+    void setColon(bool visible)
+    {
+        if (visible != _colon)
+        {
+            _colon = visible;
+            this->invalidate();
+        }
+    }
+
+protected:
+    void draw(SBK_MAX72xxCanvas<Driver> &canvas) override
+    {
+        const char sep = _colon ? ':' : ' ';
+        char text[9] = {
+            static_cast<char>('0' + _hours / 10 % 10), static_cast<char>('0' + _hours % 10), sep,
+            static_cast<char>('0' + _minutes / 10 % 10), static_cast<char>('0' + _minutes % 10), sep,
+            static_cast<char>('0' + _seconds / 10 % 10), static_cast<char>('0' + _seconds % 10), '\0'};
+        if (!_showSeconds)
+            text[5] = '\0';
+
+        this->drawText(canvas, text, SBK_MAX72xxAlign::Center, *this->_font);
+    }
+
+private:
+    const bool _showSeconds;
+    uint8_t _hours = 0;
+    uint8_t _minutes = 0;
+    uint8_t _seconds = 0;
+    bool _colon = true;
+};
+
+/**
+ * @class SBK_MAX72xxScreen
+ * @brief Owns a set of widgets and refreshes only the invalid ones.
+ *
+ * @tparam MaxWidgets Maximum number of widgets.
+ */
+template <typename Driver, uint8_t MaxWidgets = 10>
+class SBK_MAX72xxScreen
+{
+public:
+    explicit SBK_MAX72xxScreen(SBK_MAX72xxCanvas<Driver> &canvas) : _canvas(canvas) {}
+
+    /**
+     * @brief Register a widget (not copied: it must outlive the screen).
+     *
+     * @return false if MaxWidgets is reached.
+     */
+    bool add(SBK_MAX72xxWidget<Driver> &widget)
+    {
+        if (_widgetsNum >= MaxWidgets)
+            return false;
+
+        _widgets[_widgetsNum++] = &widget;
+        widget.invalidate();
+        return true;
+    }
+
+    /**
+     * @brief Redraw invalid widgets, then push the changed columns to the hardware.
+     *
+     * @return Number of widgets redrawn.
+     */
+    uint8_t update()
+    {
+        uint8_t redrawn = 0;
+        for (uint8_t i = 0; i < _widgetsNum; i++)
+        {
+            if (_widgets[i]->render(_canvas))
+                redrawn++;
+        }
+
+        _canvas.show();
+        return redrawn;
+    }
+
+private:
+    SBK_MAX72xxCanvas<Driver> &_canvas;
+    SBK_MAX72xxWidget<Driver> *_widgets[MaxWidgets] = {};
+    uint8_t _widgetsNum = 0;
+};